@@ -0,0 +1,415 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : ADAPTIVE EDGE-REGION EMBEDDING (adaptive.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "adaptive.h"
+#include "encode.h"
+#include "decode.h"
+#include "stream.h"
+#include "common.h"
+#include "types.h"
+
+// Function definition for read and validate adaptive encode args
+Status read_and_validate_adaptive_encode_args(char *argv[], AdaptiveInfo *aInfo)
+{
+    memset(aInfo, 0, sizeof(AdaptiveInfo));
+
+    if (argv[2] == NULL || argv[3] == NULL)
+    {
+        printf("Error: Usage ./a.out -ea beautiful.bmp secret.txt [stego.bmp]\n");
+        return e_failure;
+    }
+    // Same extension checks as read_and_validate_encode_args
+    if (strrchr(argv[2], '.') == NULL || strcmp(strrchr(argv[2], '.'), ".bmp") != 0)
+        return e_failure;
+    if (strrchr(argv[3], '.') == NULL || strcmp(strrchr(argv[3], '.'), ".txt") != 0)
+        return e_failure;
+    aInfo->src_image_fname = argv[2];
+    aInfo->secret_fname = argv[3];
+    aInfo->stego_image_fname = argv[4] != NULL ? argv[4] : "stego.bmp";
+    return e_success;
+}
+
+// Function definition for read and validate adaptive decode args
+Status read_and_validate_adaptive_decode_args(char *argv[], AdaptiveInfo *aInfo)
+{
+    memset(aInfo, 0, sizeof(AdaptiveInfo));
+
+    if (argv[2] == NULL || strrchr(argv[2], '.') == NULL || strcmp(strrchr(argv[2], '.'), ".bmp") != 0)
+    {
+        printf("Error: Usage ./a.out -da stego.bmp [decode.txt]\n");
+        return e_failure;
+    }
+    aInfo->src_image_fname = argv[2];
+    aInfo->secret_fname = argv[3] != NULL ? argv[3] : "decode.txt";
+    return e_success;
+}
+
+// Function definition for loading the image
+Status load_adaptive_image(AdaptiveInfo *aInfo)
+{
+    FILE *fptr = fopen(aInfo->src_image_fname, "r");
+    unsigned short bits_per_pixel;
+    Status status = e_failure;
+
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", aInfo->src_image_fname);
+        return e_failure;
+    }
+    if (fread(aInfo->header, BMP_HEADER_SIZE, 1, fptr) != 1)
+    {
+        printf("Error: %s is shorter than a BMP header\n", aInfo->src_image_fname);
+        goto out;
+    }
+    memcpy(&bits_per_pixel, aInfo->header + 28, sizeof(bits_per_pixel));
+    if (bits_per_pixel != 24)
+    {
+        printf("Error: Adaptive embedding needs a 24-bit BMP\n");
+        goto out;
+    }
+    memcpy(&aInfo->width, aInfo->header + 18, sizeof(uint));
+    memcpy(&aInfo->height, aInfo->header + 22, sizeof(uint));
+    aInfo->row_size = (aInfo->width * 3 + 3) & ~3u;
+
+    aInfo->pixel_size = get_file_size(fptr) - BMP_HEADER_SIZE;
+    if (aInfo->pixel_size < (unsigned long)aInfo->row_size * aInfo->height)
+    {
+        printf("Error: %s is shorter than its pixel rows\n", aInfo->src_image_fname);
+        goto out;
+    }
+    // Slack so the gradient pass may read one block row past the last pixel
+    aInfo->pixels = calloc(aInfo->pixel_size + ADAPT_BLOCK_ROW, 1);
+    if (aInfo->pixels == NULL)
+        goto out;
+    fseek(fptr, BMP_HEADER_SIZE, SEEK_SET);
+    if (fread(aInfo->pixels, 1, aInfo->pixel_size, fptr) != aInfo->pixel_size)
+        goto out;
+
+    aInfo->blocks_x = aInfo->width / ADAPT_BLOCK;
+    aInfo->blocks_y = aInfo->height / ADAPT_BLOCK;
+    aInfo->block_count = aInfo->blocks_x * aInfo->blocks_y;
+    printf("width = %u\nheight = %u\n", aInfo->width, aInfo->height);
+    status = e_success;
+
+out:
+    fclose(fptr);
+    return status;
+}
+
+/*
+ * Score a block
+ * Description: Sum of |p - right| and |p - below| over every byte of
+ * the block, the right neighbour being the same channel of the next
+ * pixel. Values are masked with 0xFE first so LSB embedding can never
+ * change a score. A block row is 48 bytes, three SSE2 vectors.
+ */
+uint adaptive_block_score(const AdaptiveInfo *aInfo, uint bx, uint by)
+{
+    const unsigned char *block = aInfo->pixels + (unsigned long)by * ADAPT_BLOCK * aInfo->row_size + bx * ADAPT_BLOCK_ROW;
+    uint score = 0;
+
+#ifdef __SSE2__
+    const __m128i mask = _mm_set1_epi8((char)0xFE);
+    __m128i acc = _mm_setzero_si128();
+    uint64_t lanes[2];
+
+    for (uint y = 0; y < ADAPT_BLOCK; y++)
+    {
+        const unsigned char *row = block + (unsigned long)y * aInfo->row_size;
+        int has_below = by * ADAPT_BLOCK + y + 1 < aInfo->height;
+
+        for (uint x = 0; x < ADAPT_BLOCK_ROW; x += 16)
+        {
+            __m128i p = _mm_and_si128(_mm_loadu_si128((const __m128i *)(row + x)), mask);
+            __m128i right = _mm_and_si128(_mm_loadu_si128((const __m128i *)(row + x + 3)), mask);
+
+            acc = _mm_add_epi64(acc, _mm_sad_epu8(p, right));
+            if (has_below)
+            {
+                __m128i below = _mm_and_si128(_mm_loadu_si128((const __m128i *)(row + aInfo->row_size + x)), mask);
+                acc = _mm_add_epi64(acc, _mm_sad_epu8(p, below));
+            }
+        }
+    }
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    score = lanes[0] + lanes[1];
+#else
+    for (uint y = 0; y < ADAPT_BLOCK; y++)
+    {
+        const unsigned char *row = block + (unsigned long)y * aInfo->row_size;
+        int has_below = by * ADAPT_BLOCK + y + 1 < aInfo->height;
+
+        for (uint x = 0; x < ADAPT_BLOCK_ROW; x++)
+        {
+            int p = row[x] & 0xFE;
+
+            score += abs(p - (row[x + 3] & 0xFE));
+            if (has_below)
+                score += abs(p - (row[aInfo->row_size + x] & 0xFE));
+        }
+    }
+#endif
+    return score;
+}
+
+/* Highest score first, ties by block index so the order is total */
+static int compare_block_score(const void *a, const void *b)
+{
+    const AdaptiveBlock *x = a, *y = b;
+
+    if (x->score != y->score)
+        return (x->score < y->score) - (x->score > y->score);
+    return (x->index > y->index) - (x->index < y->index);
+}
+
+// Function definition for ranking the blocks
+Status rank_adaptive_blocks(AdaptiveInfo *aInfo)
+{
+    uint bx, by;
+
+    aInfo->blocks = malloc((aInfo->block_count ? aInfo->block_count : 1) * sizeof(AdaptiveBlock));
+    if (aInfo->blocks == NULL)
+        return e_failure;
+    for (by = 0; by < aInfo->blocks_y; by++)
+    {
+        for (bx = 0; bx < aInfo->blocks_x; bx++)
+        {
+            AdaptiveBlock *block = &aInfo->blocks[by * aInfo->blocks_x + bx];
+
+            block->index = by * aInfo->blocks_x + bx;
+            block->score = adaptive_block_score(aInfo, bx, by);
+        }
+    }
+    qsort(aInfo->blocks, aInfo->block_count, sizeof(AdaptiveBlock), compare_block_score);
+    aInfo->cursor_block = aInfo->cursor_slot = 0;
+    return e_success;
+}
+
+/*
+ * Walk count slots from the cursor in ranked order, one run of a block
+ * row at a time. to_pixels copies slots into the image, else out of it.
+ */
+static Status walk_adaptive_slots(AdaptiveInfo *aInfo, char *slots, uint count, int to_pixels)
+{
+    while (count > 0)
+    {
+        uint index, row, col, run;
+        unsigned char *ptr;
+
+        if (aInfo->cursor_block >= aInfo->block_count)
+            return e_failure;
+        index = aInfo->blocks[aInfo->cursor_block].index;
+        row = aInfo->cursor_slot / ADAPT_BLOCK_ROW;
+        col = aInfo->cursor_slot % ADAPT_BLOCK_ROW;
+        ptr = aInfo->pixels + ((unsigned long)(index / aInfo->blocks_x) * ADAPT_BLOCK + row) * aInfo->row_size +
+              (index % aInfo->blocks_x) * ADAPT_BLOCK_ROW + col;
+
+        run = ADAPT_BLOCK_ROW - col;
+        if (run > count)
+            run = count;
+        if (to_pixels)
+            memcpy(ptr, slots, run);
+        else
+            memcpy(slots, ptr, run);
+        slots += run;
+        count -= run;
+
+        aInfo->cursor_slot += run;
+        if (aInfo->cursor_slot == ADAPT_BLOCK_SLOTS)
+        {
+            aInfo->cursor_block++;
+            aInfo->cursor_slot = 0;
+        }
+    }
+    return e_success;
+}
+
+// Function definition for gathering slots
+Status gather_adaptive_slots(AdaptiveInfo *aInfo, char *slots, uint count)
+{
+    return walk_adaptive_slots(aInfo, slots, count, 0);
+}
+
+// Function definition for scattering slots
+Status scatter_adaptive_slots(AdaptiveInfo *aInfo, const char *slots, uint count)
+{
+    return walk_adaptive_slots(aInfo, (char *)slots, count, 1);
+}
+
+// Function definition for do adaptive encoding
+Status do_adaptive_encoding(AdaptiveInfo *aInfo)
+{
+    const char *extn = strrchr(aInfo->secret_fname, '.');
+    uint magic_size = strlen(MAGIC_STRING), extn_size = strlen(extn), secret_size, total, offset = 0, i;
+    char *secret = NULL, *slots = NULL;
+    FILE *fptr_secret = NULL, *fptr_stego = NULL;
+    Status status = e_failure;
+
+    if (load_adaptive_image(aInfo) == e_failure || rank_adaptive_blocks(aInfo) == e_failure)
+        return e_failure;
+    printf("Ranked %u block(s) of %ux%u pixels\n", aInfo->block_count, ADAPT_BLOCK, ADAPT_BLOCK);
+
+    fptr_secret = fopen(aInfo->secret_fname, "r");
+    if (fptr_secret == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", aInfo->secret_fname);
+        goto out;
+    }
+    secret_size = get_file_size(fptr_secret);
+    fseek(fptr_secret, 0, SEEK_SET);
+
+    // Same layout as do_encoding, one slot per bit
+    total = magic_size * 8 + 32 + extn_size * 8 + 32 + secret_size * 8;
+    if (total > (unsigned long)aInfo->block_count * ADAPT_BLOCK_SLOTS)
+    {
+        printf("Error: %u slot(s) needed, %u block(s) hold %u\n", total, aInfo->block_count, aInfo->block_count * ADAPT_BLOCK_SLOTS);
+        goto out;
+    }
+    secret = malloc(secret_size ? secret_size : 1);
+    slots = malloc(total);
+    if (secret == NULL || slots == NULL || fread(secret, 1, secret_size, fptr_secret) != secret_size)
+        goto out;
+
+    if (gather_adaptive_slots(aInfo, slots, total) == e_failure)
+        goto out;
+    for (i = 0; i < magic_size; i++, offset += 8)
+        encode_byte_to_lsb(MAGIC_STRING[i], slots + offset);
+    encode_size_to_lsb(extn_size, slots + offset);
+    offset += 32;
+    for (i = 0; i < extn_size; i++, offset += 8)
+        encode_byte_to_lsb(extn[i], slots + offset);
+    encode_size_to_lsb(secret_size, slots + offset);
+    offset += 32;
+    for (i = 0; i < secret_size; i++, offset += 8)
+        encode_byte_to_lsb(secret[i], slots + offset);
+
+    aInfo->cursor_block = aInfo->cursor_slot = 0;
+    if (scatter_adaptive_slots(aInfo, slots, total) == e_failure)
+        goto out;
+    printf("Embedded %u byte(s) in %u of %u block(s)\n", secret_size,
+           aInfo->cursor_block + (aInfo->cursor_slot != 0), aInfo->block_count);
+
+    fptr_stego = fopen(aInfo->stego_image_fname, "w");
+    if (fptr_stego == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", aInfo->stego_image_fname);
+        goto out;
+    }
+    if (fwrite(aInfo->header, BMP_HEADER_SIZE, 1, fptr_stego) == 1 &&
+        fwrite(aInfo->pixels, 1, aInfo->pixel_size, fptr_stego) == aInfo->pixel_size)
+        status = e_success;
+
+out:
+    if (fptr_stego != NULL && fclose(fptr_stego) != 0)
+        status = e_failure;
+    if (fptr_secret != NULL)
+        fclose(fptr_secret);
+    free(secret);
+    free(slots);
+    return status;
+}
+
+// Function definition for do adaptive decoding
+Status do_adaptive_decoding(AdaptiveInfo *aInfo)
+{
+    char buffer[32], magic[sizeof(MAGIC_STRING)], extn[9], data[512];
+    char slots[sizeof(data) * 8];
+    int magic_size = strlen(MAGIC_STRING), extn_size, secret_size, i;
+    unsigned long remaining;
+    FILE *fptr_secret;
+    Status status = e_success;
+
+    if (load_adaptive_image(aInfo) == e_failure || rank_adaptive_blocks(aInfo) == e_failure)
+        return e_failure;
+
+    /* Header, in the same ranked order as it was embedded */
+    for (i = 0; i < magic_size; i++)
+    {
+        if (gather_adaptive_slots(aInfo, buffer, 8) == e_failure)
+            return e_failure;
+        decode_byte_from_lsb(&magic[i], buffer);
+    }
+    magic[magic_size] = '\0';
+    if (strcmp(magic, MAGIC_STRING) != 0)
+    {
+        printf("Error: Magic string decoding failed\n");
+        return e_failure;
+    }
+    if (gather_adaptive_slots(aInfo, buffer, 32) == e_failure)
+        return e_failure;
+    decode_size_from_lsb(buffer, &extn_size);
+    if (extn_size < 0 || extn_size > (int)sizeof(extn) - 1)
+    {
+        printf("Error: Invalid file extension size %d\n", extn_size);
+        return e_failure;
+    }
+    for (i = 0; i < extn_size; i++)
+    {
+        if (gather_adaptive_slots(aInfo, buffer, 8) == e_failure)
+            return e_failure;
+        decode_byte_from_lsb(&extn[i], buffer);
+    }
+    extn[extn_size] = '\0';
+    if (gather_adaptive_slots(aInfo, buffer, 32) == e_failure)
+        return e_failure;
+    decode_size_from_lsb(buffer, &secret_size);
+
+    remaining = (unsigned long)(aInfo->block_count - aInfo->cursor_block) * ADAPT_BLOCK_SLOTS - aInfo->cursor_slot;
+    if (secret_size < 0 || (unsigned long)secret_size * 8 > remaining)
+    {
+        printf("Error: Invalid secret file size %d\n", secret_size);
+        return e_failure;
+    }
+    printf("Decoded %s payload of %d byte(s)\n", extn, secret_size);
+
+    fptr_secret = fopen(aInfo->secret_fname, "w");
+    if (fptr_secret == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", aInfo->secret_fname);
+        return e_failure;
+    }
+    /* Data, a few hundred bytes at a time */
+    while (secret_size > 0)
+    {
+        int n = secret_size < (int)sizeof(data) ? secret_size : (int)sizeof(data);
+
+        if (gather_adaptive_slots(aInfo, slots, n * 8) == e_failure)
+        {
+            printf("Error: Stego image ended before the secret data\n");
+            status = e_failure;
+            break;
+        }
+        for (i = 0; i < n; i++)
+            decode_byte_from_lsb(&data[i], slots + i * 8);
+        if (fwrite(data, 1, n, fptr_secret) != (size_t)n)
+        {
+            status = e_failure;
+            break;
+        }
+        secret_size -= n;
+    }
+    if (fclose(fptr_secret) != 0)
+        status = e_failure;
+    return status;
+}
+
+// Function definition for releasing the adaptive buffers
+void free_adaptive_info(AdaptiveInfo *aInfo)
+{
+    free(aInfo->pixels);
+    free(aInfo->blocks);
+    aInfo->pixels = NULL;
+    aInfo->blocks = NULL;
+}
@@ -0,0 +1,85 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : ADAPTIVE EDGE-REGION EMBEDDING (adaptive.h) */
+
+#ifndef ADAPTIVE_H
+#define ADAPTIVE_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * Content-adaptive embedding for 24-bit BMP images.
+ * The pixel rows are split into 16x16 pixel blocks and every block is
+ * scored by its gradient magnitude: the sum of |horizontal| and
+ * |vertical| neighbour differences per channel, computed on the pixel
+ * values with the LSB masked off. Blocks are ranked by score (ties by
+ * block index) and the payload - same layout as -e: magic, extn size,
+ * extn, size, data - is embedded into the LSBs of the highest scoring
+ * blocks first. Embedding only touches LSBs, so the decoder rebuilds
+ * the exact same ranking from the stego image alone.
+ */
+
+#define ADAPT_BLOCK 16                                  // Block side in pixels
+#define ADAPT_BLOCK_ROW (ADAPT_BLOCK * 3)               // Bytes of one block row
+#define ADAPT_BLOCK_SLOTS (ADAPT_BLOCK * ADAPT_BLOCK_ROW)   // LSB slots per block
+
+typedef struct _AdaptiveBlock {
+    uint index;                 // Block number, row-major from the first pixel row
+    uint score;                 // Gradient magnitude of the block
+} AdaptiveBlock;
+
+typedef struct _AdaptiveInfo {
+    char *src_image_fname;      // Filename - src image (encode) or stego image (decode)
+    char *secret_fname;         // Filename - secret file (encode) or decoded o/p (decode)
+    char *stego_image_fname;    // Filename - stego image (encode)
+
+    char header[54];            // BMP header
+    uint width;
+    uint height;
+    uint row_size;              // Bytes per row including padding
+    unsigned char *pixels;      // Everything after the header
+    uint pixel_size;
+
+    uint blocks_x;              // Whole blocks per row
+    uint blocks_y;              // Whole blocks per column
+    uint block_count;
+    AdaptiveBlock *blocks;      // Ranked, best block first
+
+    uint cursor_block;          // Position of the next slot in ranked order
+    uint cursor_slot;
+} AdaptiveInfo;
+
+/* Adaptive function prototypes */
+
+/* Read and validate adaptive encode args: -ea <.bmp> <.txt> [stego.bmp] */
+Status read_and_validate_adaptive_encode_args(char *argv[], AdaptiveInfo *aInfo);
+
+/* Read and validate adaptive decode args: -da <stego.bmp> [decode.txt] */
+Status read_and_validate_adaptive_decode_args(char *argv[], AdaptiveInfo *aInfo);
+
+/* Read the header and pixel data of an image */
+Status load_adaptive_image(AdaptiveInfo *aInfo);
+
+/* Score one block, LSBs ignored */
+uint adaptive_block_score(const AdaptiveInfo *aInfo, uint bx, uint by);
+
+/* Score and rank every whole block */
+Status rank_adaptive_blocks(AdaptiveInfo *aInfo);
+
+/* Copy the next count slots, in ranked order, into slots */
+Status gather_adaptive_slots(AdaptiveInfo *aInfo, char *slots, uint count);
+
+/* Copy count slots back, in ranked order */
+Status scatter_adaptive_slots(AdaptiveInfo *aInfo, const char *slots, uint count);
+
+/* Perform the adaptive encoding */
+Status do_adaptive_encoding(AdaptiveInfo *aInfo);
+
+/* Perform the adaptive decoding */
+Status do_adaptive_decoding(AdaptiveInfo *aInfo);
+
+/* Release the pixel data and the ranking */
+void free_adaptive_info(AdaptiveInfo *aInfo);
+
+#endif
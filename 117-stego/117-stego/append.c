@@ -0,0 +1,198 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : INCREMENTAL APPEND (append.c) */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "append.h"
+#include "encode.h"
+#include "decode.h"
+#include "carrier.h"
+#include "common.h"
+#include "probes.h"
+#include "types.h"
+
+// Function definition for read and validate append args
+Status read_and_validate_append_args(char *argv[], AppendInfo *apInfo)
+{
+    memset(apInfo, 0, sizeof(AppendInfo));
+
+    if (argv[2] == NULL || argv[3] == NULL)
+    {
+        printf("Error: Usage ./a.out -a stego.bmp delta.txt\n");
+        return e_failure;
+    }
+    // Same carrier formats as -e/-d, the stego image is updated in place
+    apInfo->carrier = find_carrier_format(argv[2]);
+    if (apInfo->carrier == NULL)
+    {
+        printf("Error: %s is not a .bmp or .wav file\n", argv[2]);
+        return e_failure;
+    }
+    apInfo->stego_image_fname = argv[2];
+    apInfo->delta_fname = argv[3];
+    return e_success;
+}
+
+// Function definition for reading the stego header
+Status read_append_header(AppendInfo *apInfo)
+{
+    char buffer[32], raw[32 * CARRIER_MAX_STRIDE], magic[sizeof(MAGIC_STRING)], ch;
+    int magic_size = strlen(MAGIC_STRING), value, i;
+    unsigned long used;
+
+    fseek(apInfo->fptr_stego_image, 0, SEEK_SET);
+    if (apInfo->carrier->parse_header(apInfo->fptr_stego_image, &apInfo->header_size, &apInfo->capacity) == e_failure)
+        return e_failure;
+
+    // Same layout as do_decoding: magic, extn size, extn, size
+    for (i = 0; i < magic_size; i++)
+    {
+        if (read_carrier_slots(apInfo->carrier, apInfo->fptr_stego_image, raw, buffer, 8) == e_failure)
+            return e_failure;
+        decode_byte_from_lsb(&magic[i], buffer);
+    }
+    magic[magic_size] = '\0';
+    if (strcmp(magic, MAGIC_STRING) != 0)
+    {
+        printf("Error: %s has no embedded payload\n", apInfo->stego_image_fname);
+        return e_failure;
+    }
+
+    if (read_carrier_slots(apInfo->carrier, apInfo->fptr_stego_image, raw, buffer, 32) == e_failure)
+        return e_failure;
+    decode_size_from_lsb(buffer, &value);
+    if (value < 0 || value > 8)
+    {
+        printf("Error: Invalid file extension size %d\n", value);
+        return e_failure;
+    }
+    apInfo->extn_size = value;
+    for (i = 0; i < value; i++)
+    {
+        if (read_carrier_slots(apInfo->carrier, apInfo->fptr_stego_image, raw, buffer, 8) == e_failure)
+            return e_failure;
+        decode_byte_from_lsb(&ch, buffer);
+    }
+
+    apInfo->size_field_offset = ftell(apInfo->fptr_stego_image);
+    if (read_carrier_slots(apInfo->carrier, apInfo->fptr_stego_image, raw, buffer, 32) == e_failure)
+        return e_failure;
+    decode_size_from_lsb(buffer, &value);
+    if (value < 0)
+    {
+        printf("Error: Invalid secret file size %d\n", value);
+        return e_failure;
+    }
+    apInfo->size_secret_file = value;
+    printf("Current payload is %u byte(s)\n", apInfo->size_secret_file);
+
+    // Slots the payload uses now, plus the delta
+    used = magic_size * 8 + 32 + apInfo->extn_size * 8 + 32 + (unsigned long)apInfo->size_secret_file * 8;
+    if (used + (unsigned long)apInfo->size_delta * 8 > apInfo->capacity)
+    {
+        printf("Error: Carrier has room for %lu more byte(s)\n", used < apInfo->capacity ? (apInfo->capacity - used) / 8 : 0);
+        return e_failure;
+    }
+    return e_success;
+}
+
+/*
+ * Embed the delta
+ * Description: Each chunk reads the slots right after the current
+ * payload end, puts the delta bits in their LSBs and writes the
+ * slots back to the same offset.
+ */
+Status append_delta_data(AppendInfo *apInfo)
+{
+    char data[APPEND_CHUNK], slots[APPEND_CHUNK * 8], raw[APPEND_CHUNK * 8 * CARRIER_MAX_STRIDE];
+    uint stride = apInfo->carrier->stride, remaining = apInfo->size_delta;
+    long offset = apInfo->size_field_offset + (32 + (long)apInfo->size_secret_file * 8) * stride;
+
+    fseek(apInfo->fptr_delta, 0, SEEK_SET);
+    while (remaining > 0)
+    {
+        uint n = remaining < APPEND_CHUNK ? remaining : APPEND_CHUNK;
+
+        if (fread(data, 1, n, apInfo->fptr_delta) != n)
+            return e_failure;
+        fseek(apInfo->fptr_stego_image, offset, SEEK_SET);
+        if (read_carrier_slots(apInfo->carrier, apInfo->fptr_stego_image, raw, slots, n * 8) == e_failure)
+            return e_failure;
+        for (uint i = 0; i < n; i++)
+            encode_byte_to_lsb(data[i], slots + i * 8);
+        // A seek is needed between reading and writing an update stream
+        fseek(apInfo->fptr_stego_image, offset, SEEK_SET);
+        if (write_carrier_slots(apInfo->carrier, apInfo->fptr_stego_image, raw, slots, n * 8) == e_failure)
+            return e_failure;
+
+        offset += (long)n * 8 * stride;
+        remaining -= n;
+    }
+    STEGO_PROBE_BLOCK("append_delta_data", apInfo->size_delta, apInfo->size_delta * 8);
+    return e_success;
+}
+
+// Function definition for rewriting the size field
+Status update_secret_file_size(AppendInfo *apInfo, uint size)
+{
+    char buffer[32], raw[32 * CARRIER_MAX_STRIDE];
+
+    fseek(apInfo->fptr_stego_image, apInfo->size_field_offset, SEEK_SET);
+    if (read_carrier_slots(apInfo->carrier, apInfo->fptr_stego_image, raw, buffer, 32) == e_failure)
+        return e_failure;
+    // Same encoding as encode_secret_file_size
+    encode_size_to_lsb(size, buffer);
+    fseek(apInfo->fptr_stego_image, apInfo->size_field_offset, SEEK_SET);
+    if (write_carrier_slots(apInfo->carrier, apInfo->fptr_stego_image, raw, buffer, 32) == e_failure)
+        return e_failure;
+    STEGO_PROBE_BLOCK("update_secret_file_size", 4, 32);
+    return e_success;
+}
+
+// Function definition for do append
+Status do_append(AppendInfo *apInfo)
+{
+    Status status = e_failure;
+
+    apInfo->fptr_stego_image = fopen(apInfo->stego_image_fname, "r+");
+    apInfo->fptr_delta = fopen(apInfo->delta_fname, "r");
+    if (apInfo->fptr_stego_image == NULL || apInfo->fptr_delta == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open %s or %s\n", apInfo->stego_image_fname, apInfo->delta_fname);
+        goto out;
+    }
+    apInfo->size_delta = get_file_size(apInfo->fptr_delta);
+
+    if (STEGO_TRACE_STAGE("read_append_header", read_append_header(apInfo)) == e_failure)
+    {
+        printf("Failed to read the stego header\n");
+        goto out;
+    }
+    if (STEGO_TRACE_STAGE("append_delta_data", append_delta_data(apInfo)) == e_failure)
+    {
+        printf("Failed to embed the appended data\n");
+        goto out;
+    }
+
+    // The data must be on disk before the size field points at it
+    fflush(apInfo->fptr_stego_image);
+    fsync(fileno(apInfo->fptr_stego_image));
+    if (STEGO_TRACE_STAGE("update_secret_file_size", update_secret_file_size(apInfo, apInfo->size_secret_file + apInfo->size_delta)) == e_failure)
+    {
+        printf("Failed to update the secret file size\n");
+        goto out;
+    }
+    printf("Appended %u byte(s), payload is now %u byte(s)\n", apInfo->size_delta, apInfo->size_secret_file + apInfo->size_delta);
+    status = e_success;
+
+out:
+    if (apInfo->fptr_delta != NULL)
+        fclose(apInfo->fptr_delta);
+    if (apInfo->fptr_stego_image != NULL && fclose(apInfo->fptr_stego_image) != 0)
+        status = e_failure;
+    apInfo->fptr_delta = apInfo->fptr_stego_image = NULL;
+    return status;
+}
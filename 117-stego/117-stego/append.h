@@ -0,0 +1,56 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : INCREMENTAL APPEND (append.h) */
+
+#ifndef APPEND_H
+#define APPEND_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * Append bytes to the payload of an existing stego image in place.
+ * The header (magic, extn size, extn, size) is read back, the new
+ * bytes are embedded into the slots right after the current payload
+ * end and only then the 32 slot size field is rewritten. Work and I/O
+ * are proportional to the appended bytes, not to the carrier. A crash
+ * before the size field is rewritten leaves the old payload intact.
+ */
+
+#define APPEND_CHUNK 512        // Appended bytes embedded per read/write
+
+struct _CarrierFormat;  // carrier.h
+
+typedef struct _AppendInfo {
+    char *stego_image_fname;                // Stego image, updated in place
+    FILE *fptr_stego_image;
+    char *delta_fname;                      // Bytes to append
+    FILE *fptr_delta;
+
+    const struct _CarrierFormat *carrier;   // Carrier format of the stego image
+    uint header_size;                       // Bytes before the first slot
+    uint capacity;                          // Slots in the carrier
+    uint extn_size;                         // Size of the stored extension
+    long size_field_offset;                 // File offset of the size field
+    uint size_secret_file;                  // Payload size before the append
+    uint size_delta;                        // Bytes to append
+} AppendInfo;
+
+/* Append function prototypes */
+
+/* Read and validate append args: -a <stego.bmp> <delta.txt> */
+Status read_and_validate_append_args(char *argv[], AppendInfo *apInfo);
+
+/* Perform the append */
+Status do_append(AppendInfo *apInfo);
+
+/* Read the magic string, extn and size of the stego image */
+Status read_append_header(AppendInfo *apInfo);
+
+/* Embed the delta after the current payload end */
+Status append_delta_data(AppendInfo *apInfo);
+
+/* Rewrite the size field in place */
+Status update_secret_file_size(AppendInfo *apInfo, uint size);
+
+#endif
@@ -0,0 +1,96 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : PER-JOB ARENA (arena.c) */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include "arena.h"
+#include "types.h"
+
+/*
+ * Map an arena
+ * Description: One extra huge page is mapped so the base can be moved
+ * up to a 2 MB boundary, the unused head and tail are unmapped again.
+ */
+Status init_arena(Arena *arena, size_t size)
+{
+    size_t map_size, head;
+    char *map;
+
+    memset(arena, 0, sizeof(Arena));
+    size = (size + ARENA_HUGE_PAGE - 1) & ~(ARENA_HUGE_PAGE - 1);
+    map_size = size + ARENA_HUGE_PAGE;
+    map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED)
+    {
+        perror("mmap");
+        return e_failure;
+    }
+
+    head = (ARENA_HUGE_PAGE - ((uintptr_t)map & (ARENA_HUGE_PAGE - 1))) & (ARENA_HUGE_PAGE - 1);
+    if (head > 0)
+        munmap(map, head);
+    if (map_size - head - size > 0)
+        munmap(map + head + size, map_size - head - size);
+
+    arena->base = map + head;
+    arena->size = size;
+#ifdef MADV_HUGEPAGE
+    madvise(arena->base, arena->size, MADV_HUGEPAGE);   // Only a hint
+#endif
+    return e_success;
+}
+
+// Function definition for allocating from the arena
+void *arena_alloc(Arena *arena, size_t size)
+{
+    size_t start = (arena->used + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+    if (arena->base == NULL || start + size > arena->size)
+        return NULL;
+    arena->used = start + size;
+    return arena->base + start;
+}
+
+// Function definition for giving a file an arena buffer
+Status set_arena_buffer(Arena *arena, FILE *fptr)
+{
+    char *buffer;
+
+    // Without an arena stdio allocates its own buffer as usual
+    if (arena == NULL || fptr == NULL)
+        return e_success;
+    buffer = arena_alloc(arena, ARENA_IO_BUF_SIZE);
+    if (buffer == NULL)
+    {
+        arena->misses++;
+        return e_failure;
+    }
+    return setvbuf(fptr, buffer, _IOFBF, ARENA_IO_BUF_SIZE) == 0 ? e_success : e_failure;
+}
+
+// Function definition for resetting the arena after a job
+void reset_arena(Arena *arena)
+{
+    if (arena->used > arena->peak)
+        arena->peak = arena->used;
+    arena->used = 0;
+    arena->jobs++;
+}
+
+// Function definition for printing the arena stats
+void print_arena_stats(const Arena *arena)
+{
+    printf("Arena: %lu job(s), peak %zu of %zu bytes, %lu heap fallback(s)\n",
+           arena->jobs, arena->peak > arena->used ? arena->peak : arena->used, arena->size, arena->misses);
+}
+
+// Function definition for unmapping the arena
+void free_arena(Arena *arena)
+{
+    if (arena->base != NULL)
+        munmap(arena->base, arena->size);
+    memset(arena, 0, sizeof(Arena));
+}
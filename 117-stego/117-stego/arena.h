@@ -0,0 +1,55 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : PER-JOB ARENA (arena.h) */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * Bump allocator owned by one worker and reset after every job.
+ * The memory is mapped once, aligned to a 2 MB huge page and advised
+ * for transparent huge pages. Only the setvbuf buffers of the job's
+ * files come from it, the FILE structs themselves are still allocated
+ * by fopen on the heap. When the arena is full (or a job has none)
+ * stdio allocates its own buffer as usual.
+ */
+
+#define ARENA_HUGE_PAGE (2UL * 1024 * 1024)     // Alignment and size granularity
+#define ARENA_DEFAULT_SIZE ARENA_HUGE_PAGE      // One huge page per worker
+#define ARENA_ALIGN 64                          // Alignment of every allocation
+#define ARENA_IO_BUF_SIZE 65536                 // stdio buffer per file
+
+typedef struct _Arena {
+    char *base;                 // Huge page aligned mapping
+    size_t size;                // Bytes mapped
+    size_t used;                // Bytes handed out since the last reset
+    size_t peak;                // Largest used seen at a reset
+    unsigned long jobs;         // Resets so far
+    unsigned long misses;       // Allocations the arena could not serve
+} Arena;
+
+/* Arena function prototypes */
+
+/* Map an arena of at least size bytes */
+Status init_arena(Arena *arena, size_t size);
+
+/* Allocate size bytes, NULL when the arena is full */
+void *arena_alloc(Arena *arena, size_t size);
+
+/* Give a freshly opened file a buffer from the arena */
+Status set_arena_buffer(Arena *arena, FILE *fptr);
+
+/* Forget every allocation, at the end of a job */
+void reset_arena(Arena *arena);
+
+/* Print the usage of the arena */
+void print_arena_stats(const Arena *arena);
+
+/* Unmap the arena */
+void free_arena(Arena *arena);
+
+#endif
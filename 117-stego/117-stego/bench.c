@@ -0,0 +1,461 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : ROUND TRIP THROUGHPUT CHECK (bench.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include "bench.h"
+#include "encode.h"
+#include "decode.h"
+#include "stream.h"
+#include "types.h"
+
+/* Carriers of the corpus, odd widths need row padding */
+static const struct {
+    uint width;
+    uint height;
+    uint bits_per_pixel;
+} bench_carriers[] = {
+    { 64, 64, 24 },
+    { 333, 211, 24 },
+    { 1024, 768, 24 },
+    { 2001, 1003, 24 },
+    { 640, 480, 32 },
+    { 1001, 333, 32 },
+};
+
+static const char *bench_payloads[] = { "text", "binary", "compressible" };
+
+#define BENCH_CARRIERS (sizeof(bench_carriers) / sizeof(bench_carriers[0]))
+#define BENCH_PAYLOADS (sizeof(bench_payloads) / sizeof(bench_payloads[0]))
+
+/* xorshift32, the corpus must be the same on every run */
+static uint bench_random(uint *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static void put_le16(unsigned char *ptr, uint value)
+{
+    ptr[0] = value;
+    ptr[1] = value >> 8;
+}
+
+static void put_le32(unsigned char *ptr, uint value)
+{
+    put_le16(ptr, value);
+    put_le16(ptr + 2, value >> 16);
+}
+
+// Function definition for read and validate bench args
+Status read_and_validate_bench_args(char *argv[], BenchInfo *bInfo)
+{
+    memset(bInfo, 0, sizeof(BenchInfo));
+
+    bInfo->baseline_fname = argv[2] != NULL ? argv[2] : "bench_baseline.txt";
+    bInfo->threshold = (argv[2] != NULL && argv[3] != NULL) ? atoi(argv[3]) : BENCH_DEFAULT_THRESHOLD;
+    if (bInfo->threshold < 1 || bInfo->threshold > 99)
+    {
+        printf("Error: Threshold must be between 1 and 99 %%\n");
+        return e_failure;
+    }
+    return e_success;
+}
+
+// Function definition for writing a carrier
+Status write_bench_carrier(const char *fname, uint width, uint height, uint bits_per_pixel)
+{
+    uint bytes_per_pixel = bits_per_pixel / 8;
+    uint row_size = (width * bytes_per_pixel + 3) & ~3u;
+    uint state = width * 7919 + height * 31 + bits_per_pixel;
+    unsigned char header[BMP_HEADER_SIZE] = { 'B', 'M' };
+    unsigned char *row;
+    FILE *fptr;
+
+    put_le32(header + 2, BMP_HEADER_SIZE + row_size * height);
+    put_le32(header + 10, BMP_HEADER_SIZE);
+    put_le32(header + 14, 40);
+    put_le32(header + 18, width);
+    put_le32(header + 22, height);
+    put_le16(header + 26, 1);
+    put_le16(header + 28, bits_per_pixel);
+    put_le32(header + 34, row_size * height);
+
+    fptr = fopen(fname, "w");
+    row = calloc(row_size, 1);
+    if (fptr == NULL || row == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", fname);
+        if (fptr != NULL)
+            fclose(fptr);
+        free(row);
+        return e_failure;
+    }
+    fwrite(header, BMP_HEADER_SIZE, 1, fptr);
+    // Gradient with a little noise, padding stays zero
+    for (uint y = 0; y < height; y++)
+    {
+        for (uint x = 0; x < width * bytes_per_pixel; x++)
+            row[x] = (x * 3 + y * 5 + (bench_random(&state) & 0x0F)) & 0xFF;
+        fwrite(row, row_size, 1, fptr);
+    }
+    free(row);
+    return fclose(fptr) == 0 ? e_success : e_failure;
+}
+
+// Function definition for writing a payload
+Status write_bench_payload(const char *fname, const char *kind, uint size)
+{
+    static const char *words[] = { "stego", "carrier", "pixel", "secret", "the", "of", "bitmap", "header", "lsb", "magic" };
+    uint state = size * 2654435761u + 1;
+    FILE *fptr = fopen(fname, "w");
+    uint i = 0;
+
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", fname);
+        return e_failure;
+    }
+    if (strcmp(kind, "text") == 0)
+    {
+        // Words and newlines, no NUL bytes
+        while (i < size)
+        {
+            const char *word = words[bench_random(&state) % 10];
+
+            for (; *word && i < size; word++, i++)
+                fputc(*word, fptr);
+            if (i < size)
+            {
+                fputc(bench_random(&state) % 8 ? ' ' : '\n', fptr);
+                i++;
+            }
+        }
+    }
+    else if (strcmp(kind, "binary") == 0)
+    {
+        // Every byte value, NULs included
+        for (; i < size; i++)
+            fputc(bench_random(&state) & 0xFF, fptr);
+    }
+    else
+    {
+        // Long runs of a few values
+        for (; i < size; i++)
+            fputc((i / 97) % 4 ? 0 : 'A' + (i / 388) % 26, fptr);
+    }
+    return fclose(fptr) == 0 ? e_success : e_failure;
+}
+
+/* read/write syscalls of this process so far, 0 without I/O accounting */
+static unsigned long read_io_syscalls(void)
+{
+    char line[64];
+    unsigned long value, count = 0;
+    FILE *fptr = fopen("/proc/self/io", "r");
+
+    if (fptr == NULL)
+        return 0;
+    while (fgets(line, sizeof(line), fptr) != NULL)
+    {
+        if (sscanf(line, "syscr: %lu", &value) == 1 || sscanf(line, "syscw: %lu", &value) == 1)
+            count += value;
+    }
+    fclose(fptr);
+    return count;
+}
+
+/* Same steps as main for -e */
+static Status bench_encode(char *src, char *secret, char *stego)
+{
+    char *args[] = { "a.out", "-e", src, secret, stego, NULL };
+    EncodeInfo encInfo;
+    Status status;
+
+    memset(&encInfo, 0, sizeof(EncodeInfo));
+    if (read_and_validate_encode_args(args, &encInfo) == e_failure)
+        return e_failure;
+    status = do_encoding(&encInfo);
+    if (close_files(&encInfo) == e_failure)
+        status = e_failure;
+    return status;
+}
+
+/* Same steps as main for -d */
+static Status bench_decode(char *stego, char *output)
+{
+    char *args[] = { "a.out", "-d", stego, output, NULL };
+    DecodeInfo decInfo;
+    Status status = e_success;
+
+    memset(&decInfo, 0, sizeof(DecodeInfo));
+    if (read_and_validate_decode_args(args, &decInfo) == d_failure)
+        return e_failure;
+    if (do_decoding(&decInfo) == d_failure)
+        status = e_failure;
+    if (close_files_dec(&decInfo) == d_failure)
+        status = e_failure;
+    return status;
+}
+
+/*
+ * Run one step in a child process
+ * Description: The child gets stdout on /dev/null, so the progress
+ * messages cost what they always cost without flooding the report.
+ * Returns the wall time in seconds, -1 on failure.
+ */
+static double run_bench_child(int decode, char *src, char *secret, char *out, long *rss_kb, unsigned long *syscalls)
+{
+    struct timespec start, end;
+    struct rusage usage;
+    int fds[2], wstatus;
+    pid_t pid;
+
+    if (pipe(fds) != 0)
+        return -1;
+    fflush(stdout);
+    fflush(stderr);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pid = fork();
+    if (pid == 0)
+    {
+        int devnull = open("/dev/null", O_WRONLY);
+        unsigned long count;
+        Status status;
+
+        close(fds[0]);
+        dup2(devnull, STDOUT_FILENO);
+        status = decode ? bench_decode(src, out) : bench_encode(src, secret, out);
+        fflush(stdout);
+        count = read_io_syscalls();
+        if (write(fds[1], &count, sizeof(count)) != sizeof(count))
+            status = e_failure;
+        _exit(status == e_success ? 0 : 1);
+    }
+    close(fds[1]);
+    if (pid == -1 || wait4(pid, &wstatus, 0, &usage) != pid)
+    {
+        close(fds[0]);
+        return -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (read(fds[0], syscalls, sizeof(*syscalls)) != sizeof(*syscalls))
+        *syscalls = 0;
+    close(fds[0]);
+    *rss_kb = usage.ru_maxrss;
+    if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
+        return -1;
+    return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+/* Compare two files byte by byte */
+static int files_identical(const char *fname1, const char *fname2)
+{
+    char buffer1[4096], buffer2[4096];
+    FILE *fptr1 = fopen(fname1, "r"), *fptr2 = fopen(fname2, "r");
+    int identical = fptr1 != NULL && fptr2 != NULL;
+
+    while (identical)
+    {
+        size_t n1 = fread(buffer1, 1, sizeof(buffer1), fptr1);
+        size_t n2 = fread(buffer2, 1, sizeof(buffer2), fptr2);
+
+        if (n1 != n2 || memcmp(buffer1, buffer2, n1) != 0)
+            identical = 0;
+        if (n1 == 0)
+            break;
+    }
+    if (fptr1 != NULL)
+        fclose(fptr1);
+    if (fptr2 != NULL)
+        fclose(fptr2);
+    return identical;
+}
+
+// Function definition for running one case
+Status run_bench_case(BenchInfo *bInfo, const char *carrier, const char *payload, BenchResult *result)
+{
+    char src[128], secret[128], stego[128], output[140], decoded[128];
+    double best_encode = 0, best_decode = 0;
+    struct stat st;
+
+    if (stat(carrier, &st) != 0)
+        return e_failure;
+    snprintf(stego, sizeof(stego), "%s/stego.bmp", bInfo->dir);
+    snprintf(decoded, sizeof(decoded), "%s/decoded", bInfo->dir);  // read_and_validate_decode_args drops the extension
+
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        unsigned long encode_syscalls, decode_syscalls;
+        long encode_rss, decode_rss;
+        double encode_time, decode_time;
+
+        // Arguments are edited in place (strtok), fresh copies every run
+        snprintf(src, sizeof(src), "%s", carrier);
+        snprintf(secret, sizeof(secret), "%s", payload);
+        snprintf(output, sizeof(output), "%s.txt", decoded);
+
+        encode_time = run_bench_child(0, src, secret, stego, &encode_rss, &encode_syscalls);
+        decode_time = encode_time < 0 ? -1 : run_bench_child(1, stego, NULL, output, &decode_rss, &decode_syscalls);
+        if (encode_time < 0 || decode_time < 0)
+        {
+            printf("Error: %s failed to %s\n", result->name, encode_time < 0 ? "encode" : "decode");
+            unlink(stego);
+            unlink(decoded);
+            return e_failure;
+        }
+
+        if (run == 0 || encode_time < best_encode)
+            best_encode = encode_time;
+        if (run == 0 || decode_time < best_decode)
+            best_decode = decode_time;
+        if (run == 0 || (encode_rss > decode_rss ? encode_rss : decode_rss) < result->peak_rss_kb)
+            result->peak_rss_kb = encode_rss > decode_rss ? encode_rss : decode_rss;
+        if (run == 0 || encode_syscalls + decode_syscalls < result->syscalls)
+            result->syscalls = encode_syscalls + decode_syscalls;
+    }
+
+    result->wall_ms = (best_encode + best_decode) * 1e3;
+    result->encode_mbps = st.st_size / best_encode / 1e6;
+    result->decode_mbps = st.st_size / best_decode / 1e6;
+    result->identical = files_identical(payload, decoded);
+    unlink(stego);
+    unlink(decoded);
+    return e_success;
+}
+
+// Function definition for checking against the baseline
+Status check_bench_baseline(BenchInfo *bInfo)
+{
+    char line[256], name[BENCH_NAME_SIZE];
+    double encode_mbps, decode_mbps, wall_ms, limit = bInfo->threshold / 100.0;
+    long peak_rss_kb;
+    unsigned long syscalls;
+    int compared = 0;
+    FILE *fptr = fopen(bInfo->baseline_fname, "r");
+
+    // No baseline yet - record this run as the baseline
+    if (fptr == NULL)
+    {
+        fptr = fopen(bInfo->baseline_fname, "w");
+        if (fptr == NULL)
+        {
+            perror("fopen");
+            fprintf(stderr, "ERROR: Unable to open file %s\n", bInfo->baseline_fname);
+            return e_failure;
+        }
+        fprintf(fptr, "# case encode_MB/s decode_MB/s peak_RSS_KB syscalls wall_ms\n");
+        for (int i = 0; i < bInfo->result_count; i++)
+            fprintf(fptr, "%s %.2f %.2f %ld %lu %.3f\n", bInfo->results[i].name, bInfo->results[i].encode_mbps,
+                    bInfo->results[i].decode_mbps, bInfo->results[i].peak_rss_kb, bInfo->results[i].syscalls,
+                    bInfo->results[i].wall_ms);
+        printf("Recorded baseline %s\n", bInfo->baseline_fname);
+        return fclose(fptr) == 0 ? e_success : e_failure;
+    }
+
+    while (fgets(line, sizeof(line), fptr) != NULL)
+    {
+        if (line[0] == '#' || sscanf(line, "%63s %lf %lf %ld %lu %lf", name, &encode_mbps, &decode_mbps,
+                                     &peak_rss_kb, &syscalls, &wall_ms) != 6)
+            continue;
+        for (int i = 0; i < bInfo->result_count; i++)
+        {
+            BenchResult *result = &bInfo->results[i];
+
+            if (strcmp(result->name, name) != 0)
+                continue;
+            compared++;
+            if (result->encode_mbps < encode_mbps * (1 - limit) || result->decode_mbps < decode_mbps * (1 - limit) ||
+                result->peak_rss_kb > peak_rss_kb * (1 + limit) || result->syscalls > syscalls * (1 + limit) ||
+                result->wall_ms > wall_ms * (1 + limit))
+            {
+                printf("REGRESSION %s: %.2f/%.2f MB/s, %ld KB, %lu syscalls, %.3f ms "
+                       "(baseline %.2f/%.2f MB/s, %ld KB, %lu syscalls, %.3f ms)\n", name,
+                       result->encode_mbps, result->decode_mbps, result->peak_rss_kb, result->syscalls, result->wall_ms,
+                       encode_mbps, decode_mbps, peak_rss_kb, syscalls, wall_ms);
+                bInfo->failed++;
+            }
+        }
+    }
+    fclose(fptr);
+    printf("Compared %d case(s) with %s, threshold %d%%\n", compared, bInfo->baseline_fname, bInfo->threshold);
+    return e_success;
+}
+
+// Function definition for do bench
+Status do_bench(BenchInfo *bInfo)
+{
+    char carrier[128], payload[128];
+    Status status = e_success;
+
+    snprintf(bInfo->dir, sizeof(bInfo->dir), "/tmp/stego_bench_XXXXXX");    // No '.' - see run_bench_case
+    if (mkdtemp(bInfo->dir) == NULL)
+    {
+        perror("mkdtemp");
+        return e_failure;
+    }
+    bInfo->results = calloc(BENCH_CARRIERS * BENCH_PAYLOADS, sizeof(BenchResult));
+    if (bInfo->results == NULL)
+    {
+        rmdir(bInfo->dir);
+        return e_failure;
+    }
+
+    printf("%-24s %10s %10s %9s %9s %9s %s\n", "case", "enc MB/s", "dec MB/s", "wall ms", "RSS KB", "syscalls", "output");
+    for (uint c = 0; c < BENCH_CARRIERS && status == e_success; c++)
+    {
+        uint width = bench_carriers[c].width, height = bench_carriers[c].height;
+        // Half of what check_capacity allows
+        uint size = width * height * 3 / 8 / 2 - 16;
+
+        if (size > BENCH_MAX_PAYLOAD)
+            size = BENCH_MAX_PAYLOAD;
+        snprintf(carrier, sizeof(carrier), "%s/carrier.bmp", bInfo->dir);
+        if (write_bench_carrier(carrier, width, height, bench_carriers[c].bits_per_pixel) == e_failure)
+            status = e_failure;
+
+        for (uint p = 0; p < BENCH_PAYLOADS && status == e_success; p++)
+        {
+            BenchResult *result = &bInfo->results[bInfo->result_count++];
+
+            snprintf(result->name, sizeof(result->name), "%ux%ux%u-%s", width, height, bench_carriers[c].bits_per_pixel, bench_payloads[p]);
+            snprintf(payload, sizeof(payload), "%s/payload.txt", bInfo->dir);
+            if (write_bench_payload(payload, bench_payloads[p], size) == e_failure ||
+                run_bench_case(bInfo, carrier, payload, result) == e_failure)
+            {
+                // The scratch directory has to be empty for rmdir
+                unlink(payload);
+                status = e_failure;
+                break;
+            }
+            printf("%-24s %10.2f %10.2f %9.1f %9ld %9lu %s\n", result->name, result->encode_mbps, result->decode_mbps,
+                   result->wall_ms, result->peak_rss_kb, result->syscalls, result->identical ? "identical" : "MISMATCH");
+            if (!result->identical)
+                bInfo->failed++;
+            unlink(payload);
+        }
+        unlink(carrier);
+    }
+    rmdir(bInfo->dir);
+
+    if (status == e_success && check_bench_baseline(bInfo) == e_failure)
+        status = e_failure;
+    free(bInfo->results);
+    bInfo->results = NULL;
+
+    printf("%d case(s), %d failed\n", bInfo->result_count, bInfo->failed);
+    return status == e_success && bInfo->failed == 0 ? e_success : e_failure;
+}
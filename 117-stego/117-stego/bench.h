@@ -0,0 +1,70 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : ROUND TRIP THROUGHPUT CHECK (bench.h) */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * End-to-end regression check for -e / -d.
+ * A deterministic corpus is generated in a scratch directory: BMP
+ * carriers of several sizes (24 and 32 bits per pixel, widths that
+ * need row padding) and text, random binary and compressible
+ * payloads. Every carrier/payload pair is encoded and decoded in a
+ * child process, the decoded file must be byte-identical to the
+ * payload. Per case the best of BENCH_RUNS runs is kept: encode and
+ * decode MB/s (carrier bytes per second), wall time, peak RSS and
+ * read/write syscalls. The results are compared with a baseline file
+ * and the check fails when any of them is more than threshold % worse
+ * for a case; without a baseline file one is recorded.
+ */
+
+#define BENCH_RUNS 3                    // Runs per case, the best one counts
+#define BENCH_DEFAULT_THRESHOLD 25      // Allowed regression in %
+#define BENCH_MAX_PAYLOAD (256 * 1024)  // Payload size cap in bytes
+#define BENCH_NAME_SIZE 64
+
+typedef struct _BenchResult {
+    char name[BENCH_NAME_SIZE];     // <width>x<height>x<bpp>-<payload>
+    double encode_mbps;
+    double decode_mbps;
+    double wall_ms;                 // Best encode + best decode wall time
+    long peak_rss_kb;               // Largest of the encode and decode child
+    unsigned long syscalls;         // Fewest read/write syscalls of encode + decode
+    int identical;                  // Decoded file matched the payload
+} BenchResult;
+
+typedef struct _BenchInfo {
+    char *baseline_fname;           // Baseline to compare with or record
+    int threshold;                  // Allowed regression in %
+    char dir[64];                   // Scratch directory for the corpus
+
+    BenchResult *results;
+    int result_count;
+    int failed;                     // Mismatches and regressions
+} BenchInfo;
+
+/* Bench function prototypes */
+
+/* Read and validate bench args: -bench [baseline.txt] [threshold %] */
+Status read_and_validate_bench_args(char *argv[], BenchInfo *bInfo);
+
+/* Write a deterministic BMP carrier */
+Status write_bench_carrier(const char *fname, uint width, uint height, uint bits_per_pixel);
+
+/* Write a deterministic payload of the given kind ("text", "binary", "compressible") */
+Status write_bench_payload(const char *fname, const char *kind, uint size);
+
+/* Run one carrier/payload round trip */
+Status run_bench_case(BenchInfo *bInfo, const char *carrier, const char *payload, BenchResult *result);
+
+/* Compare the results with the baseline, or record it */
+Status check_bench_baseline(BenchInfo *bInfo);
+
+/* Perform the whole check */
+Status do_bench(BenchInfo *bInfo);
+
+#endif
@@ -0,0 +1,251 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : ONE-TO-MANY ENCODING (broadcast.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "broadcast.h"
+#include "encode.h"
+#include "stream.h"
+#include "common.h"
+#include "probes.h"
+#include "types.h"
+
+// Function definition for read and validate one-to-many args
+Status read_and_validate_broadcast_args(int argc, char *argv[], BroadcastInfo *bInfo)
+{
+    char *extn;
+
+    memset(bInfo, 0, sizeof(BroadcastInfo));
+
+    // -eo <secret.txt> <stego prefix> <carrier.bmp>...
+    if (argc < 5)
+    {
+        printf("Error: Usage ./a.out -eo secret.txt stego_prefix carrier1.bmp [carrier2.bmp ...]\n");
+        return e_failure;
+    }
+
+    // Same rule as read_and_validate_encode_args
+    extn = strrchr(argv[2], '.');
+    if (extn == NULL || strcmp(extn, ".txt") != 0)
+    {
+        printf("Error: Secret file is not a .txt file\n");
+        return e_failure;
+    }
+    bInfo->secret_fname = argv[2];
+    bInfo->stego_prefix = argv[3];
+
+    for (int i = 4; i < argc; i++)
+    {
+        extn = strrchr(argv[i], '.');
+        if (extn == NULL || strcmp(extn, ".bmp") != 0)
+        {
+            printf("Error: Carrier %s is not a .bmp file\n", argv[i]);
+            return e_failure;
+        }
+    }
+    bInfo->image_fnames = &argv[4];
+    bInfo->image_count = argc - 4;
+    return e_success;
+}
+
+// Function definition for building the payload bit plane
+Status build_payload_bitstream(BroadcastInfo *bInfo)
+{
+    char *extn = strrchr(bInfo->secret_fname, '.');
+    uint extn_size = strlen(extn);
+    uint magic_size = strlen(MAGIC_STRING);
+    uint size_secret_file, i;
+    char *bits, *data;
+    FILE *fptr_secret;
+
+    fptr_secret = fopen(bInfo->secret_fname, "r");
+    if (fptr_secret == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", bInfo->secret_fname);
+        return e_failure;
+    }
+    size_secret_file = get_file_size(fptr_secret);
+    fseek(fptr_secret, 0, SEEK_SET);
+    bInfo->size_secret_file = size_secret_file;
+
+    // Same layout as do_encoding: 8 carrier bytes per byte, 32 per size field
+    bInfo->bitstream_size = magic_size * 8 + 32 + extn_size * 8 + 32 + size_secret_file * 8;
+    bInfo->bitstream = calloc(bInfo->bitstream_size, 1);
+    data = malloc(size_secret_file + 1);
+    if (bInfo->bitstream == NULL || data == NULL)
+    {
+        printf("Error: Unable to allocate the bit plane\n");
+        free(data);
+        fclose(fptr_secret);
+        return e_failure;
+    }
+    if (fread(data, 1, size_secret_file, fptr_secret) != size_secret_file)
+    {
+        printf("Error: Unable to read secret file %s\n", bInfo->secret_fname);
+        free(data);
+        fclose(fptr_secret);
+        return e_failure;
+    }
+    fclose(fptr_secret);
+
+    // LSB encoders on a zeroed buffer leave exactly the bit plane behind
+    bits = bInfo->bitstream;
+    for (i = 0; i < magic_size; i++, bits += 8)
+        encode_byte_to_lsb(MAGIC_STRING[i], bits);
+    encode_size_to_lsb(extn_size, bits);
+    bits += 32;
+    for (i = 0; i < extn_size; i++, bits += 8)
+        encode_byte_to_lsb(extn[i], bits);
+    encode_size_to_lsb(size_secret_file, bits);
+    bits += 32;
+    for (i = 0; i < size_secret_file; i++, bits += 8)
+        encode_byte_to_lsb(data[i], bits);
+
+    free(data);
+    printf("Built bit plane of %u bytes for %u byte secret\n", bInfo->bitstream_size, size_secret_file);
+    return e_success;
+}
+
+// Function definition for blending a block
+void blend_lsb_block(char *dest, const char *src, const char *bits, uint size)
+{
+    uint i = 0;
+
+#ifdef __SSE2__
+    const __m128i mask = _mm_set1_epi8((char)0xFE);
+
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i image = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i plane = _mm_loadu_si128((const __m128i *)(bits + i));
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_or_si128(_mm_and_si128(image, mask), plane));
+    }
+#else
+    // Eight bytes at a time
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t image, plane;
+
+        memcpy(&image, src + i, 8);
+        memcpy(&plane, bits + i, 8);
+        image = (image & 0xFEFEFEFEFEFEFEFEull) | plane;
+        memcpy(dest + i, &image, 8);
+    }
+#endif
+    for (; i < size; i++)
+        dest[i] = (src[i] & 0xFE) | bits[i];
+}
+
+// Function definition for blending the bit plane into one carrier
+Status blend_bitstream_to_image(BroadcastInfo *bInfo, FILE *fptr_src_image, FILE *fptr_stego_image)
+{
+    static char block[BROADCAST_BLOCK_SIZE];
+    char header[BMP_HEADER_SIZE];
+    uint offset = 0;
+    size_t n;
+
+    // Header is read once, capacity comes from it. Same check as check_capacity
+    if (fread(header, BMP_HEADER_SIZE, 1, fptr_src_image) != 1)
+        return e_failure;
+    if (get_image_size_from_header(header) <= get_required_capacity(bInfo->secret_fname, bInfo->size_secret_file))
+    {
+        printf("Error: Carrier is too small for the secret\n");
+        return e_failure;
+    }
+    fwrite(header, BMP_HEADER_SIZE, 1, fptr_stego_image);
+
+    // Embedded region
+    while (offset < bInfo->bitstream_size)
+    {
+        uint size = bInfo->bitstream_size - offset;
+
+        if (size > BROADCAST_BLOCK_SIZE)
+            size = BROADCAST_BLOCK_SIZE;
+        if (fread(block, 1, size, fptr_src_image) != size)
+        {
+            printf("Error: Carrier is truncated\n");
+            return e_failure;
+        }
+        blend_lsb_block(block, block, bInfo->bitstream + offset, size);
+        fwrite(block, 1, size, fptr_stego_image);
+        offset += size;
+    }
+    STEGO_PROBE_BLOCK("blend_bitstream_to_image", bInfo->bitstream_size / 8, bInfo->bitstream_size);
+
+    // Rest of the carrier as it is
+    while ((n = fread(block, 1, BROADCAST_BLOCK_SIZE, fptr_src_image)) > 0)
+        fwrite(block, 1, n, fptr_stego_image);
+    return e_success;
+}
+
+// Function definition for do one-to-many encoding
+Status do_broadcast_encoding(BroadcastInfo *bInfo)
+{
+    char stego_fname[320];
+    int i, failed = 0;
+
+    if (STEGO_TRACE_STAGE("build_payload_bitstream", build_payload_bitstream(bInfo)) == e_failure)
+    {
+        printf("Failed to build the payload bit plane\n");
+        return e_failure;
+    }
+
+    for (i = 0; i < bInfo->image_count; i++)
+    {
+        FILE *fptr_src_image, *fptr_stego_image;
+        Status status;
+
+        snprintf(stego_fname, sizeof(stego_fname), "%s_%d.bmp", bInfo->stego_prefix, i);
+        fptr_src_image = fopen(bInfo->image_fnames[i], "r");
+        if (fptr_src_image == NULL)
+        {
+            perror("fopen");
+            fprintf(stderr, "ERROR: Unable to open file %s\n", bInfo->image_fnames[i]);
+            failed++;
+            continue;
+        }
+        fptr_stego_image = fopen(stego_fname, "w");
+        if (fptr_stego_image == NULL)
+        {
+            perror("fopen");
+            fprintf(stderr, "ERROR: Unable to open file %s\n", stego_fname);
+            fclose(fptr_src_image);
+            failed++;
+            continue;
+        }
+
+        STEGO_PROBE_JOB_START("encode");
+        status = blend_bitstream_to_image(bInfo, fptr_src_image, fptr_stego_image);
+        fclose(fptr_src_image);
+        if (fclose(fptr_stego_image) != 0)
+            status = e_failure;
+        STEGO_PROBE_JOB_END("encode", status);
+
+        if (status == e_success)
+        {
+            printf("%s -> %s\n", bInfo->image_fnames[i], stego_fname);
+        }
+        else
+        {
+            printf("Failed to encode %s\n", bInfo->image_fnames[i]);
+            failed++;
+        }
+    }
+
+    printf("%d carrier(s), %d failed\n", bInfo->image_count, failed);
+    return failed ? e_failure : e_success;
+}
+
+// Function definition for releasing the bit plane
+void free_broadcast_info(BroadcastInfo *bInfo)
+{
+    free(bInfo->bitstream);
+    bInfo->bitstream = NULL;
+}
@@ -0,0 +1,52 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : ONE-TO-MANY ENCODING (broadcast.h) */
+
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * Embed the same secret into many carriers.
+ * The whole header + payload (magic, extn size, extn, size, data) is
+ * expanded once into a bit plane: one byte (0 or 1) per carrier byte,
+ * in carrier byte order, exactly as do_encoding lays it out. Every
+ * carrier then only needs (carrier & 0xFE) | bit over that region.
+ */
+
+#define BROADCAST_BLOCK_SIZE 65536      // Carrier bytes blended per block
+
+typedef struct _BroadcastInfo {
+    char *secret_fname;         // Secret file embedded into every carrier
+    char *stego_prefix;         // Prefix for the stego images
+    char **image_fnames;        // Carrier images
+    int image_count;            // Number of carriers
+
+    char *bitstream;            // Pre-expanded LSB plane of header + payload
+    uint bitstream_size;        // Carrier bytes covered by the bit plane
+    uint size_secret_file;      // Secret size, for the capacity check
+} BroadcastInfo;
+
+/* Broadcast function prototypes */
+
+/* Read and validate one-to-many args: -eo <secret.txt> <stego prefix> <carrier.bmp>... */
+Status read_and_validate_broadcast_args(int argc, char *argv[], BroadcastInfo *bInfo);
+
+/* Build the bit plane once and blend it into every carrier */
+Status do_broadcast_encoding(BroadcastInfo *bInfo);
+
+/* Expand magic, extn size, extn, size and data of the secret into the bit plane */
+Status build_payload_bitstream(BroadcastInfo *bInfo);
+
+/* Blend the bit plane into one carrier */
+Status blend_bitstream_to_image(BroadcastInfo *bInfo, FILE *fptr_src_image, FILE *fptr_stego_image);
+
+/* dest[i] = (src[i] & 0xFE) | bits[i] */
+void blend_lsb_block(char *dest, const char *src, const char *bits, uint size);
+
+/* Release the bit plane */
+void free_broadcast_info(BroadcastInfo *bInfo);
+
+#endif
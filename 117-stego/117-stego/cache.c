@@ -0,0 +1,223 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : CARRIER CACHE (cache.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "cache.h"
+#include "encode.h"
+#include "types.h"
+
+/* djb2 hash of the carrier path */
+static uint carrier_hash(const char *fname)
+{
+    uint hash = 5381;
+
+    while (*fname)
+        hash = hash * 33 + (unsigned char)*fname++;
+    return hash % CARRIER_CACHE_BUCKETS;
+}
+
+/* Remove an entry from the LRU list */
+static void lru_unlink(CarrierCache *cache, CarrierEntry *entry)
+{
+    if (entry->prev)
+        entry->prev->next = entry->next;
+    else
+        cache->head = entry->next;
+    if (entry->next)
+        entry->next->prev = entry->prev;
+    else
+        cache->tail = entry->prev;
+    entry->prev = entry->next = NULL;
+}
+
+/* Insert an entry at the head (most recently used) of the LRU list */
+static void lru_push_front(CarrierCache *cache, CarrierEntry *entry)
+{
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if (cache->head)
+        cache->head->prev = entry;
+    cache->head = entry;
+    if (cache->tail == NULL)
+        cache->tail = entry;
+}
+
+/* Remove an entry from the cache and free it */
+static void carrier_cache_drop(CarrierCache *cache, CarrierEntry *entry)
+{
+    CarrierEntry **link = &cache->buckets[carrier_hash(entry->fname)];
+
+    while (*link != entry)
+        link = &(*link)->hnext;
+    *link = entry->hnext;
+
+    lru_unlink(cache, entry);
+    cache->used -= entry->size;
+    free(entry->fname);
+    free(entry->data);
+    free(entry);
+}
+
+/* Evict least recently used, unpinned entries until size more bytes fit */
+static void carrier_cache_evict(CarrierCache *cache, size_t size)
+{
+    CarrierEntry *entry = cache->tail;
+
+    while (entry && cache->used + size > cache->budget)
+    {
+        CarrierEntry *prev = entry->prev;
+
+        if (entry->refs == 0)
+        {
+            carrier_cache_drop(cache, entry);
+            cache->evictions++;
+        }
+        entry = prev;
+    }
+}
+
+/* Read a whole carrier into a new entry */
+static CarrierEntry *carrier_cache_load(const char *fname, const struct stat *st)
+{
+    CarrierEntry *entry;
+    FILE *fptr;
+
+    entry = calloc(1, sizeof(CarrierEntry));
+    if (entry == NULL)
+        return NULL;
+    entry->fname = strdup(fname);
+    entry->data = malloc(st->st_size);
+    if (entry->fname == NULL || entry->data == NULL)
+        goto fail;
+
+    fptr = fopen(fname, "r");
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", fname);
+        goto fail;
+    }
+    entry->size = fread(entry->data, 1, st->st_size, fptr);
+    fclose(fptr);
+    if (entry->size != (uint)st->st_size)
+        goto fail;
+
+    // Parse the header once, hits reuse the capacity
+    fptr = carrier_cache_open(entry);
+    if (fptr == NULL)
+        goto fail;
+    entry->image_capacity = get_image_size_for_bmp(fptr);
+    fclose(fptr);
+
+    entry->dev = st->st_dev;
+    entry->ino = st->st_ino;
+    entry->mtime = st->st_mtim;
+    return entry;
+
+fail:
+    free(entry->fname);
+    free(entry->data);
+    free(entry);
+    return NULL;
+}
+
+// Function definition for init carrier cache
+Status init_carrier_cache(CarrierCache *cache, size_t budget)
+{
+    memset(cache, 0, sizeof(CarrierCache));
+    cache->budget = budget;
+    return e_success;
+}
+
+// Function definition for carrier cache lookup
+CarrierEntry *carrier_cache_get(CarrierCache *cache, const char *fname)
+{
+    CarrierEntry *entry;
+    struct stat st;
+    uint bucket = carrier_hash(fname);
+
+    if (stat(fname, &st) != 0)
+    {
+        perror("stat");
+        fprintf(stderr, "ERROR: Unable to stat file %s\n", fname);
+        return NULL;
+    }
+
+    for (entry = cache->buckets[bucket]; entry; entry = entry->hnext)
+    {
+        if (strcmp(entry->fname, fname) != 0)
+            continue;
+
+        // Same path, same file and not modified since it was loaded
+        if (entry->dev == st.st_dev && entry->ino == st.st_ino &&
+            entry->mtime.tv_sec == st.st_mtim.tv_sec && entry->mtime.tv_nsec == st.st_mtim.tv_nsec)
+        {
+            cache->hits++;
+            lru_unlink(cache, entry);
+            lru_push_front(cache, entry);
+            entry->refs++;
+            return entry;
+        }
+
+        // Stale entry, reload it unless a job still uses it
+        if (entry->refs > 0)
+            return NULL;
+        carrier_cache_drop(cache, entry);
+        break;
+    }
+
+    cache->misses++;
+
+    // Carriers larger than the whole budget are not cached
+    if ((size_t)st.st_size > cache->budget)
+        return NULL;
+
+    carrier_cache_evict(cache, st.st_size);
+    entry = carrier_cache_load(fname, &st);
+    if (entry == NULL)
+        return NULL;
+
+    entry->hnext = cache->buckets[bucket];
+    cache->buckets[bucket] = entry;
+    lru_push_front(cache, entry);
+    cache->used += entry->size;
+    entry->refs++;
+    return entry;
+}
+
+// Function definition for carrier cache release
+void carrier_cache_release(CarrierCache *cache, CarrierEntry *entry)
+{
+    if (entry == NULL)
+        return;
+    entry->refs--;
+
+    // Entries pinned during an eviction may have left the cache over budget
+    if (cache->used > cache->budget)
+        carrier_cache_evict(cache, 0);
+}
+
+// Function definition for opening a stream over a cached carrier
+FILE *carrier_cache_open(CarrierEntry *entry)
+{
+    // The stream reads straight from the cached buffer, no copy
+    return fmemopen(entry->data, entry->size, "r");
+}
+
+// Function definition for printing the cache counters
+void print_carrier_cache_stats(const CarrierCache *cache)
+{
+    printf("Carrier cache: %lu hit(s), %lu miss(es), %lu eviction(s), %zu of %zu bytes used\n",
+           cache->hits, cache->misses, cache->evictions, cache->used, cache->budget);
+}
+
+// Function definition for freeing the carrier cache
+void free_carrier_cache(CarrierCache *cache)
+{
+    while (cache->head)
+        carrier_cache_drop(cache, cache->head);
+}
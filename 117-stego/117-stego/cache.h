@@ -0,0 +1,73 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : CARRIER CACHE (cache.h) */
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdio.h>
+#include <sys/types.h>
+#include <time.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * In-memory LRU cache of parsed carrier images.
+ * An entry is keyed by path and validated against the inode and
+ * mtime of the file, so a carrier replaced on disk is reloaded.
+ * Entries hold the whole carrier (header + pixel data) and its
+ * capacity; the least recently used ones are evicted once the
+ * memory budget is exceeded.
+ */
+
+#define CARRIER_CACHE_BUCKETS 256                   // Hash buckets for the path lookup
+#define DEFAULT_CARRIER_CACHE_MB 256                // Default memory budget in MB
+
+typedef struct _CarrierEntry {
+    char *fname;                    // Path of the carrier (cache key)
+    dev_t dev;                      // Device of the file when loaded
+    ino_t ino;                      // Inode of the file when loaded
+    struct timespec mtime;          // Modification time when loaded
+
+    char *data;                     // Whole carrier file (header + pixel data)
+    uint size;                      // Size of data in bytes
+    uint image_capacity;            // Capacity as per get_image_size_for_bmp
+    int refs;                       // Pinned while a job is using the entry
+
+    struct _CarrierEntry *prev;     // LRU list (head = most recently used)
+    struct _CarrierEntry *next;
+    struct _CarrierEntry *hnext;    // Hash bucket chain
+} CarrierEntry;
+
+typedef struct _CarrierCache {
+    CarrierEntry *buckets[CARRIER_CACHE_BUCKETS];
+    CarrierEntry *head;             // Most recently used
+    CarrierEntry *tail;             // Least recently used
+    size_t budget;                  // Memory budget in bytes
+    size_t used;                    // Bytes held by the cached carriers
+
+    unsigned long hits;             // Lookups served from memory
+    unsigned long misses;           // Lookups that had to read the disk
+    unsigned long evictions;        // Entries dropped to stay in budget
+} CarrierCache;
+
+/* Cache function prototypes */
+
+/* Initialise an empty cache with a memory budget in bytes */
+Status init_carrier_cache(CarrierCache *cache, size_t budget);
+
+/* Look up a carrier, loading it on a miss. Returns a pinned entry or NULL */
+CarrierEntry *carrier_cache_get(CarrierCache *cache, const char *fname);
+
+/* Unpin an entry returned by carrier_cache_get */
+void carrier_cache_release(CarrierCache *cache, CarrierEntry *entry);
+
+/* Open a read only stream over a cached carrier */
+FILE *carrier_cache_open(CarrierEntry *entry);
+
+/* Print the hit/miss counters */
+void print_carrier_cache_stats(const CarrierCache *cache);
+
+/* Drop every entry */
+void free_carrier_cache(CarrierCache *cache);
+
+#endif
@@ -0,0 +1,180 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : CARRIER FORMATS (carrier.c) */
+
+#include <stdio.h>
+#include <string.h>
+#include "carrier.h"
+#include "stream.h"
+#include "types.h"
+
+/* Little-endian fields, as stored in RIFF headers */
+static uint read_le16(const unsigned char *ptr)
+{
+    return ptr[0] | ptr[1] << 8;
+}
+
+static uint read_le32(const unsigned char *ptr)
+{
+    return ptr[0] | ptr[1] << 8 | ptr[2] << 16 | (uint)ptr[3] << 24;
+}
+
+/* Skip bytes by reading them, so streams work too */
+static Status skip_bytes(FILE *fptr, uint size)
+{
+    char buffer[4096];
+
+    while (size > 0)
+    {
+        uint n = size < sizeof(buffer) ? size : sizeof(buffer);
+
+        if (fread(buffer, 1, n, fptr) != n)
+            return e_failure;
+        size -= n;
+    }
+    return e_success;
+}
+
+// Function definition for parsing a BMP header
+static Status parse_bmp_header(FILE *fptr, uint *header_size, uint *capacity)
+{
+    char header[BMP_HEADER_SIZE];
+
+    if (fread(header, BMP_HEADER_SIZE, 1, fptr) != 1)
+        return e_failure;
+    *header_size = BMP_HEADER_SIZE;
+    *capacity = get_image_size_from_header(header);
+    return e_success;
+}
+
+/*
+ * Parse a WAV header
+ * Description: Chunks are walked until "data", which must come after
+ * a "fmt " chunk describing 16-bit PCM. Every sample is one slot.
+ */
+static Status parse_wav_header(FILE *fptr, uint *header_size, uint *capacity)
+{
+    unsigned char riff[12], chunk[8], fmt[16];
+    uint offset = sizeof(riff), size;
+    int have_fmt = 0;
+
+    if (fread(riff, sizeof(riff), 1, fptr) != 1 || memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0)
+    {
+        printf("Error: Not a RIFF/WAVE file\n");
+        return e_failure;
+    }
+
+    while (fread(chunk, sizeof(chunk), 1, fptr) == 1)
+    {
+        size = read_le32(chunk + 4);
+        offset += sizeof(chunk);
+
+        if (memcmp(chunk, "data", 4) == 0)
+        {
+            if (!have_fmt)
+            {
+                printf("Error: WAV data chunk before fmt chunk\n");
+                return e_failure;
+            }
+            *header_size = offset;
+            *capacity = size / 2;
+            return e_success;
+        }
+
+        if (memcmp(chunk, "fmt ", 4) == 0)
+        {
+            if (size < sizeof(fmt) || fread(fmt, sizeof(fmt), 1, fptr) != 1)
+                return e_failure;
+            // Format tag 1 is plain PCM
+            if (read_le16(fmt) != 1 || read_le16(fmt + 14) != 16)
+            {
+                printf("Error: Only 16-bit PCM WAV is supported\n");
+                return e_failure;
+            }
+            printf("channels = %u\n", read_le16(fmt + 2));
+            printf("sample rate = %u\n", read_le32(fmt + 4));
+            have_fmt = 1;
+            if (skip_bytes(fptr, size - sizeof(fmt) + (size & 1)) == e_failure)
+                return e_failure;
+        }
+        // Chunks are padded to an even size
+        else if (skip_bytes(fptr, size + (size & 1)) == e_failure)
+            return e_failure;
+        offset += size + (size & 1);
+    }
+    printf("Error: No data chunk in WAV file\n");
+    return e_failure;
+}
+
+const CarrierFormat bmp_format = { ".bmp", 1, parse_bmp_header };
+const CarrierFormat wav_format = { ".wav", 2, parse_wav_header };
+
+// Function definition for finding the carrier format
+const CarrierFormat *find_carrier_format(const char *fname)
+{
+    static const CarrierFormat *formats[] = { &bmp_format, &wav_format };
+    const char *extn = strrchr(fname, '.');
+
+    if (extn == NULL)
+        return NULL;
+    for (uint i = 0; i < sizeof(formats) / sizeof(formats[0]); i++)
+    {
+        if (strcmp(extn, formats[i]->extn) == 0)
+            return formats[i];
+    }
+    return NULL;
+}
+
+// Function definition for checking the BMP layout
+int is_bmp_format(const CarrierFormat *format)
+{
+    return format == NULL || format == &bmp_format;
+}
+
+// Function definition for copying the carrier header
+Status copy_carrier_header(FILE *fptr_src, FILE *fptr_dest, uint header_size)
+{
+    char buffer[4096];
+
+    fseek(fptr_src, 0, SEEK_SET);
+    while (header_size > 0)
+    {
+        uint n = header_size < sizeof(buffer) ? header_size : sizeof(buffer);
+
+        if (fread(buffer, 1, n, fptr_src) != n || fwrite(buffer, 1, n, fptr_dest) != n)
+            return e_failure;
+        header_size -= n;
+    }
+    return e_success;
+}
+
+// Function definition for reading carrier slots
+Status read_carrier_slots(const CarrierFormat *format, FILE *fptr, char *raw, char *slots, uint count)
+{
+    uint stride = format ? format->stride : 1;
+
+    // Byte slots need no gathering
+    if (stride == 1)
+        return fread(slots, count, 1, fptr) == 1 ? e_success : e_failure;
+
+    if (fread(raw, stride, count, fptr) != count)
+        return e_failure;
+    for (uint i = 0; i < count; i++)
+        slots[i] = raw[i * stride];
+    return e_success;
+}
+
+// Function definition for writing carrier slots
+Status write_carrier_slots(const CarrierFormat *format, FILE *fptr, char *raw, const char *slots, uint count)
+{
+    uint stride = format ? format->stride : 1;
+
+    if (stride == 1)
+        return fwrite(slots, count, 1, fptr) == 1 ? e_success : e_failure;
+
+    for (uint i = 0; i < count; i++)
+        raw[i * stride] = slots[i];
+    if (fwrite(raw, stride, count, fptr) != count)
+        return e_failure;
+    return e_success;
+}
@@ -0,0 +1,52 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : CARRIER FORMATS (carrier.h) */
+
+#ifndef CARRIER_H
+#define CARRIER_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * A carrier format describes where the embedding engine may write.
+ * Every format has a header that is copied as is, followed by slots:
+ * one slot holds one embedded bit in the LSB of its first byte.
+ *  - BMP: 54 byte header, every pixel byte is a slot
+ *  - WAV: RIFF header up to the "data" chunk, every 16-bit PCM sample
+ *         is a slot (LSB of the little-endian sample)
+ * Slots are read and written a block at a time, so a carrier of any
+ * length is streamed in constant memory.
+ */
+
+#define CARRIER_MAX_STRIDE 2    // Largest slot size in bytes (16-bit sample)
+
+typedef struct _CarrierFormat {
+    const char *extn;           // File extension, e.g. ".bmp"
+    uint stride;                // Bytes per slot, the LSB is in the first one
+
+    /* Parse the header from offset 0, leaving fptr at the first slot */
+    Status (*parse_header)(FILE *fptr, uint *header_size, uint *capacity);
+} CarrierFormat;
+
+extern const CarrierFormat bmp_format;
+extern const CarrierFormat wav_format;
+
+/* Carrier format function prototypes */
+
+/* Get the carrier format for a file name by its extension (NULL if unsupported) */
+const CarrierFormat *find_carrier_format(const char *fname);
+
+/* Check whether a format uses the BMP layout (NULL - BMP, the default) */
+int is_bmp_format(const CarrierFormat *format);
+
+/* Copy the carrier header, header_size bytes from offset 0 */
+Status copy_carrier_header(FILE *fptr_src, FILE *fptr_dest, uint header_size);
+
+/* Read count slots: raw gets count * stride bytes, slots the LSB byte of each */
+Status read_carrier_slots(const CarrierFormat *format, FILE *fptr, char *raw, char *slots, uint count);
+
+/* Put the slots back into raw and write count * stride bytes */
+Status write_carrier_slots(const CarrierFormat *format, FILE *fptr, char *raw, const char *slots, uint count);
+
+#endif
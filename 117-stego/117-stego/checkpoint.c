@@ -0,0 +1,328 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : CHECKPOINT AND RESUME (checkpoint.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "checkpoint.h"
+#include "encode.h"
+#include "common.h"
+#include "probes.h"
+#include "carrier.h"
+#include "types.h"
+
+#define FNV64_OFFSET 14695981039346656037ull
+#define FNV64_PRIME 1099511628211ull
+
+/* Continue an FNV-1a 64 hash over a buffer */
+static unsigned long long fnv64_update(unsigned long long hash, const unsigned char *data, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+        hash = (hash ^ data[i]) * FNV64_PRIME;
+    return hash;
+}
+
+// Function definition for hashing a file prefix
+Status hash_file_prefix(FILE *fptr, unsigned long size, unsigned long long *hash)
+{
+    unsigned char buffer[65536];
+
+    fseek(fptr, 0, SEEK_SET);
+    while (size > 0)
+    {
+        size_t n = size < sizeof(buffer) ? size : sizeof(buffer);
+
+        if (fread(buffer, 1, n, fptr) != n)
+            return e_failure;
+        *hash = fnv64_update(*hash, buffer, n);
+        size -= n;
+    }
+    return e_success;
+}
+
+// Function definition for writing the sidecar file
+Status write_checkpoint(EncodeInfo *encInfo, CheckpointInfo *ckpt)
+{
+    char tmp_fname[340];
+    FILE *fptr;
+
+    // Offsets must never point past data that is not on disk yet
+    fflush(encInfo->fptr_stego_image);
+    fsync(fileno(encInfo->fptr_stego_image));
+
+    snprintf(tmp_fname, sizeof(tmp_fname), "%s.tmp", ckpt->sidecar_fname);
+    fptr = fopen(tmp_fname, "w");
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", tmp_fname);
+        return e_failure;
+    }
+    fprintf(fptr, "carrier %s\n", encInfo->src_image_fname);
+    fprintf(fptr, "secret %s\n", encInfo->secret_fname);
+    fprintf(fptr, "carrier_size %lu\n", ckpt->carrier_size);
+    fprintf(fptr, "secret_size %lu\n", ckpt->secret_size);
+    fprintf(fptr, "carrier_offset %lu\n", ckpt->carrier_offset);
+    fprintf(fptr, "payload_offset %lu\n", ckpt->payload_offset);
+    fprintf(fptr, "output_offset %lu\n", ckpt->output_offset);
+    fprintf(fptr, "hash %016llx\n", ckpt->hash);
+    fflush(fptr);
+    fsync(fileno(fptr));
+    if (fclose(fptr) != 0 || rename(tmp_fname, ckpt->sidecar_fname) != 0)
+    {
+        perror("checkpoint");
+        return e_failure;
+    }
+    return e_success;
+}
+
+// Function definition for reading the sidecar file
+Status read_checkpoint(EncodeInfo *encInfo, CheckpointInfo *ckpt)
+{
+    char carrier[320], secret[320];
+    FILE *fptr;
+    int fields;
+
+    fptr = fopen(ckpt->sidecar_fname, "r");
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", ckpt->sidecar_fname);
+        return e_failure;
+    }
+    fields = fscanf(fptr, "carrier %319s secret %319s carrier_size %lu secret_size %lu "
+                          "carrier_offset %lu payload_offset %lu output_offset %lu hash %llx",
+                    carrier, secret, &ckpt->carrier_size, &ckpt->secret_size,
+                    &ckpt->carrier_offset, &ckpt->payload_offset, &ckpt->output_offset, &ckpt->hash);
+    fclose(fptr);
+
+    if (fields != 8)
+    {
+        printf("Error: Checkpoint %s is corrupt\n", ckpt->sidecar_fname);
+        return e_failure;
+    }
+    if (strcmp(carrier, encInfo->src_image_fname) != 0 || strcmp(secret, encInfo->secret_fname) != 0)
+    {
+        printf("Error: Checkpoint is for %s and %s\n", carrier, secret);
+        return e_failure;
+    }
+    return e_success;
+}
+
+// Function definition for embedding the secret data in chunks
+Status encode_secret_data_chunks(EncodeInfo *encInfo, CheckpointInfo *ckpt)
+{
+    static char data[CHECKPOINT_CHUNK];
+    static char block[CHECKPOINT_CHUNK * 8];
+    unsigned long next_checkpoint = ckpt->payload_offset + ckpt->interval;
+
+    while (ckpt->payload_offset < ckpt->secret_size)
+    {
+        size_t n = ckpt->secret_size - ckpt->payload_offset;
+
+        if (n > CHECKPOINT_CHUNK)
+            n = CHECKPOINT_CHUNK;
+        if (fread(data, 1, n, encInfo->fptr_secret) != n ||
+            fread(block, 8, n, encInfo->fptr_src_image) != n)
+        {
+            printf("Error: Input ended before the secret data was embedded\n");
+            return e_failure;
+        }
+
+        // Same as encode_data_to_image, one carrier block per chunk
+        for (size_t i = 0; i < n; i++)
+            encode_byte_to_lsb(data[i], block + i * 8);
+        if (fwrite(block, 8, n, encInfo->fptr_stego_image) != n)
+            return e_failure;
+        STEGO_PROBE_BLOCK("encode_secret_data_chunks", n, n * 8);
+
+        ckpt->hash = fnv64_update(ckpt->hash, (unsigned char *)block, n * 8);
+        ckpt->payload_offset += n;
+        ckpt->carrier_offset += n * 8;
+        ckpt->output_offset += n * 8;
+
+        if (ckpt->payload_offset >= next_checkpoint && ckpt->payload_offset < ckpt->secret_size)
+        {
+            if (write_checkpoint(encInfo, ckpt) == e_failure)
+                return e_failure;
+            printf("Checkpoint at %lu of %lu bytes\n", ckpt->payload_offset, ckpt->secret_size);
+            next_checkpoint = ckpt->payload_offset + ckpt->interval;
+        }
+    }
+    return e_success;
+}
+
+// Function definition for copying the remaining carrier in chunks
+Status copy_remaining_data_chunks(EncodeInfo *encInfo, CheckpointInfo *ckpt)
+{
+    static char block[CHECKPOINT_CHUNK * 8];
+    // Same spacing in carrier bytes as the payload checkpoints
+    unsigned long next_checkpoint = ckpt->carrier_offset + ckpt->interval * 8;
+
+    while (ckpt->carrier_offset < ckpt->carrier_size)
+    {
+        size_t n = ckpt->carrier_size - ckpt->carrier_offset;
+
+        if (n > sizeof(block))
+            n = sizeof(block);
+        if (fread(block, 1, n, encInfo->fptr_src_image) != n)
+        {
+            printf("Error: Carrier ended before it was copied\n");
+            return e_failure;
+        }
+        if (fwrite(block, 1, n, encInfo->fptr_stego_image) != n)
+            return e_failure;
+
+        ckpt->hash = fnv64_update(ckpt->hash, (unsigned char *)block, n);
+        ckpt->carrier_offset += n;
+        ckpt->output_offset += n;
+
+        if (ckpt->carrier_offset >= next_checkpoint && ckpt->carrier_offset < ckpt->carrier_size)
+        {
+            if (write_checkpoint(encInfo, ckpt) == e_failure)
+                return e_failure;
+            printf("Checkpoint at carrier byte %lu of %lu\n", ckpt->carrier_offset, ckpt->carrier_size);
+            next_checkpoint = ckpt->carrier_offset + ckpt->interval * 8;
+        }
+    }
+    return e_success;
+}
+
+/* Run the header stages of do_encoding and start the running hash */
+static Status checkpoint_encode_header(EncodeInfo *encInfo, CheckpointInfo *ckpt)
+{
+    long header_size;
+
+    if (check_capacity(encInfo) == e_failure)
+    {
+        printf("Check capacity is a failure\n");
+        return e_failure;
+    }
+    strcpy(encInfo->extn_secret_file, strrchr(encInfo->secret_fname, '.'));
+    copy_bmp_header(encInfo->fptr_src_image, encInfo->fptr_stego_image);
+    encode_magic_string(MAGIC_STRING, encInfo);
+    encode_secret_file_extn_size(strlen(encInfo->extn_secret_file), encInfo);
+    encode_secret_file_extn(encInfo->extn_secret_file, encInfo);
+    encode_secret_file_size(encInfo->size_secret_file, encInfo);
+
+    // Everything up to here is the header, hash it from the stego image
+    fflush(encInfo->fptr_stego_image);
+    header_size = ftell(encInfo->fptr_stego_image);
+    ckpt->hash = FNV64_OFFSET;
+    if (hash_file_prefix(encInfo->fptr_stego_image, header_size, &ckpt->hash) == e_failure)
+        return e_failure;
+    fseek(encInfo->fptr_stego_image, header_size, SEEK_SET);
+
+    ckpt->carrier_offset = ckpt->output_offset = header_size;
+    ckpt->payload_offset = 0;
+    fseek(encInfo->fptr_secret, 0, SEEK_SET);
+    return write_checkpoint(encInfo, ckpt);
+}
+
+/* Check the partial stego image against the checkpoint and seek every file to it */
+static Status checkpoint_resume(EncodeInfo *encInfo, CheckpointInfo *ckpt)
+{
+    unsigned long long hash = FNV64_OFFSET;
+
+    if (read_checkpoint(encInfo, ckpt) == e_failure)
+        return e_failure;
+
+    // Inputs must not have changed since the job started
+    if (get_file_size(encInfo->fptr_src_image) != ckpt->carrier_size ||
+        get_file_size(encInfo->fptr_secret) != ckpt->secret_size)
+    {
+        printf("Error: Carrier or secret changed since the checkpoint\n");
+        return e_failure;
+    }
+
+    // The stego image must hold exactly what was checkpointed
+    if (hash_file_prefix(encInfo->fptr_stego_image, ckpt->output_offset, &hash) == e_failure || hash != ckpt->hash)
+    {
+        printf("Error: Partial stego image does not match the checkpoint\n");
+        return e_failure;
+    }
+
+    // Drop anything written after the checkpoint
+    fflush(encInfo->fptr_stego_image);
+    if (ftruncate(fileno(encInfo->fptr_stego_image), ckpt->output_offset) != 0)
+    {
+        perror("ftruncate");
+        return e_failure;
+    }
+    fseek(encInfo->fptr_stego_image, ckpt->output_offset, SEEK_SET);
+    fseek(encInfo->fptr_src_image, ckpt->carrier_offset, SEEK_SET);
+    fseek(encInfo->fptr_secret, ckpt->payload_offset, SEEK_SET);
+    encInfo->size_secret_file = ckpt->secret_size;
+
+    printf("Resuming at %lu of %lu bytes, carrier byte %lu\n", ckpt->payload_offset, ckpt->secret_size, ckpt->carrier_offset);
+    return e_success;
+}
+
+// Function definition for do checkpoint encoding
+Status do_checkpoint_encoding(EncodeInfo *encInfo, int resume, unsigned long interval_kb)
+{
+    CheckpointInfo ckpt;
+    Status status = e_failure;
+
+    // Chunks are embedded 8 bytes per secret byte, the BMP layout
+    if (!is_bmp_format(encInfo->carrier))
+    {
+        printf("Error: Checkpoints are only supported for BMP carriers\n");
+        return e_failure;
+    }
+
+    memset(&ckpt, 0, sizeof(CheckpointInfo));
+    snprintf(ckpt.sidecar_fname, sizeof(ckpt.sidecar_fname), "%s%s", encInfo->stego_image_fname, CHECKPOINT_SUFFIX);
+    ckpt.interval = (interval_kb ? interval_kb : DEFAULT_CHECKPOINT_KB) * 1024;
+
+    /* The stego image is read back for the hash, so it is opened for update */
+    encInfo->fptr_src_image = fopen(encInfo->src_image_fname, "r");
+    encInfo->fptr_secret = fopen(encInfo->secret_fname, "r");
+    encInfo->fptr_stego_image = fopen(encInfo->stego_image_fname, resume ? "r+" : "w+");
+    if (encInfo->fptr_src_image == NULL || encInfo->fptr_secret == NULL || encInfo->fptr_stego_image == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open files for %s\n", encInfo->stego_image_fname);
+        goto out;
+    }
+    ckpt.carrier_size = get_file_size(encInfo->fptr_src_image);
+    ckpt.secret_size = get_file_size(encInfo->fptr_secret);
+
+    if (resume)
+    {
+        if (checkpoint_resume(encInfo, &ckpt) == e_failure)
+            goto out;
+    }
+    else if (checkpoint_encode_header(encInfo, &ckpt) == e_failure)
+    {
+        printf("Failed to encode header\n");
+        goto out;
+    }
+
+    if (encode_secret_data_chunks(encInfo, &ckpt) == e_failure)
+    {
+        printf("Failed to encode secret file data\n");
+        goto out;
+    }
+    printf("Encoded secret file data successfully\n");
+
+    // The payload is done, a resume from here only has the tail left to copy
+    if (ckpt.carrier_offset < ckpt.carrier_size && write_checkpoint(encInfo, &ckpt) == e_failure)
+        goto out;
+    if (copy_remaining_data_chunks(encInfo, &ckpt) == e_failure)
+    {
+        printf("Failed to copy remaining data\n");
+        goto out;
+    }
+    status = e_success;
+
+out:
+    if (close_files(encInfo) == e_failure)
+        status = e_failure;
+    // Job is complete, the checkpoint is no longer needed
+    if (status == e_success)
+        unlink(ckpt.sidecar_fname);
+    return status;
+}
@@ -0,0 +1,61 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : CHECKPOINT AND RESUME (checkpoint.h) */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+#include "encode.h"
+
+/*
+ * Periodic checkpointing for large encode jobs.
+ * The secret data is embedded in chunks; every checkpoint interval the
+ * stego image is flushed to disk and a sidecar file <stego>.ckpt
+ * records the carrier, payload and output offsets reached and a
+ * running hash (FNV-1a 64) of the stego bytes written so far. The
+ * carrier bytes after the payload are copied in chunks as well, with a
+ * checkpoint every interval * 8 bytes, so a job killed during the tail
+ * copy also resumes where it stopped.
+ * --resume checks the inputs and the partial stego image against the
+ * sidecar and continues from the recorded offsets.
+ */
+
+#define CHECKPOINT_SUFFIX ".ckpt"           // Sidecar file name suffix
+#define CHECKPOINT_CHUNK 4096               // Payload bytes embedded per chunk
+#define DEFAULT_CHECKPOINT_KB 8192          // Payload KB between checkpoints
+
+typedef struct _CheckpointInfo {
+    char sidecar_fname[320];        // <stego>.ckpt
+    unsigned long interval;         // Payload bytes between checkpoints
+
+    unsigned long carrier_size;     // Size of the carrier when the job started
+    unsigned long secret_size;      // Size of the secret when the job started
+    unsigned long carrier_offset;   // Carrier bytes consumed
+    unsigned long payload_offset;   // Secret bytes embedded
+    unsigned long output_offset;    // Stego bytes written
+    unsigned long long hash;        // FNV-1a 64 of the stego bytes written
+} CheckpointInfo;
+
+/* Checkpoint function prototypes */
+
+/* Encode with checkpoints, or resume from the last checkpoint */
+Status do_checkpoint_encoding(EncodeInfo *encInfo, int resume, unsigned long interval_kb);
+
+/* Write the sidecar file atomically (temp file + rename) */
+Status write_checkpoint(EncodeInfo *encInfo, CheckpointInfo *ckpt);
+
+/* Read the sidecar file and check it belongs to this job */
+Status read_checkpoint(EncodeInfo *encInfo, CheckpointInfo *ckpt);
+
+/* Hash the first size bytes of a file, continuing from hash */
+Status hash_file_prefix(FILE *fptr, unsigned long size, unsigned long long *hash);
+
+/* Embed the secret data in chunks from the current offsets, checkpointing on the way */
+Status encode_secret_data_chunks(EncodeInfo *encInfo, CheckpointInfo *ckpt);
+
+/* Copy the carrier after the payload in chunks from the current offsets, checkpointing on the way */
+Status copy_remaining_data_chunks(EncodeInfo *encInfo, CheckpointInfo *ckpt);
+
+#endif
@@ -8,9 +8,16 @@
 #include <string.h>
 #include "common.h"
 #include <stdlib.h>
+#include "stream.h"
+#include "probes.h"
+#include "carrier.h"
 
 Status_d read_and_validate_decode_args(char *argv[], DecodeInfo *decInfo)
 {
+    // Nothing is open or allocated yet
+    decInfo->fptr_d_src_image = decInfo->fptr_d_secret = NULL;
+    decInfo->magic_data = decInfo->d_extn_secret_file = NULL;
+
     // Check if the necessary arguments are provided
     if (argv[2] == NULL) // Ensure the source image is provided
     {
@@ -18,14 +25,16 @@ Status_d read_and_validate_decode_args(char *argv[], DecodeInfo *decInfo)
         return d_failure;
     }
 
-    if (strstr(argv[2], ".bmp")) // Validate encoded file is .bmp
+    // "-" reads stdin, always a BMP
+    decInfo->d_carrier = is_stream_fname(argv[2]) ? &bmp_format : find_carrier_format(argv[2]);
+    if (decInfo->d_carrier != NULL) // Validate encoded file is .bmp or .wav
     {
         decInfo->d_src_image_fname = argv[2];
         printf("Source image file: %s\n", decInfo->d_src_image_fname);
     }
     else
     {
-        printf("Error: Source file is not a .bmp file\n");
+        printf("Error: Source file is not a .bmp or .wav file\n");
         return d_failure;
     }
 
@@ -47,29 +56,29 @@ Status_d read_and_validate_decode_args(char *argv[], DecodeInfo *decInfo)
 Status_d do_decoding(DecodeInfo *decInfo)
 {
     /* attempts to open the source BMP image and output secret file */
-    if (open_files_dec(decInfo) == d_success)
+    if (STEGO_TRACE_STAGE("open_files_dec", open_files_dec(decInfo)) == d_success)
     {
         printf("Files opened successfully\n");
 
         /* to check for a predefined string in the image */
-        if (decode_magic_string(decInfo) == d_success)
+        if (STEGO_TRACE_STAGE("decode_magic_string", decode_magic_string(decInfo)) == d_success)
         {
             printf("Magic string decoded successfully\n");
 
             /* reads the size of the secret file extension and checks it */
-            if (decode_file_extn_size(strlen(".txt"), decInfo->fptr_d_src_image) == d_success)
+            if (STEGO_TRACE_STAGE("decode_file_extn_size", decode_file_extn_size(strlen(".txt"), decInfo)) == d_success)
             {
                 /* decodes the file extension of the secret file and verifies it */
-                if (decode_secret_file_extn(decInfo->d_extn_secret_file, decInfo) == d_success)
+                if (STEGO_TRACE_STAGE("decode_secret_file_extn", decode_secret_file_extn(decInfo->d_extn_secret_file, decInfo)) == d_success)
                 {
                     /* It reads 32 bits (4 bytes) and decodes the size using LSB */
-                    if (decode_secret_file_size(decInfo) == d_success)
+                    if (STEGO_TRACE_STAGE("decode_secret_file_size", decode_secret_file_size(decInfo)) == d_success)
                     {
                         printf("Secret file size decoded successfully\n");
                         // printf("Secret file data size: %d bytes\n", decInfo->size_secret_file);
 
                         /* Decode the secret file data */
-                        if (decode_secret_file_data(decInfo) == d_success)
+                        if (STEGO_TRACE_STAGE("decode_secret_file_data", decode_secret_file_data(decInfo)) == d_success)
                         {
                             printf("Secret file data decoded successfully\n");
                         }
@@ -108,8 +117,12 @@ Status_d do_decoding(DecodeInfo *decInfo)
 // Function definition for open files for decoding
 Status_d open_files_dec(DecodeInfo *decInfo)
 {
-    // Open the source stego image file for reading.
-    decInfo->fptr_d_src_image = fopen(decInfo->d_src_image_fname, "r");
+    // Open the source stego image file for reading ("-" reads stdin).
+    decInfo->d_src_is_stream = is_stream_fname(decInfo->d_src_image_fname);
+    if (decInfo->d_src_is_stream)
+        decInfo->fptr_d_src_image = stdin;
+    else
+        decInfo->fptr_d_src_image = fopen(decInfo->d_src_image_fname, "r");
     
     // Check if the file was opened successfully.
     if (decInfo->fptr_d_src_image == NULL)
@@ -122,8 +135,11 @@ Status_d open_files_dec(DecodeInfo *decInfo)
     // Indicate successful opening of the source image file.
     printf("Source image file opened successfully: %s\n", decInfo->d_src_image_fname);
 
-    // Open the destination file for writing the decoded secret data.
-    decInfo->fptr_d_secret = fopen(decInfo->d_secret_fname, "w");
+    // Open the destination file for writing the decoded secret data ("-" writes stdout).
+    if (is_stream_fname(decInfo->d_secret_fname))
+        decInfo->fptr_d_secret = open_stdout_stream();
+    else
+        decInfo->fptr_d_secret = fopen(decInfo->d_secret_fname, "w");
     
     // Check if the destination file was opened successfully.
     if (decInfo->fptr_d_secret == NULL)
@@ -140,17 +156,53 @@ Status_d open_files_dec(DecodeInfo *decInfo)
     return d_success;
 }
 
+// Function definition for closing the files and freeing the decoded strings
+Status_d close_files_dec(DecodeInfo *decInfo)
+{
+    Status_d status = d_success;
+
+    if (decInfo->fptr_d_src_image != NULL && decInfo->fptr_d_src_image != stdin)
+        fclose(decInfo->fptr_d_src_image);
+    // Buffered secret data is written on close, so its result matters
+    if (decInfo->fptr_d_secret != NULL && fclose(decInfo->fptr_d_secret) != 0)
+        status = d_failure;
+    decInfo->fptr_d_src_image = decInfo->fptr_d_secret = NULL;
+
+    free(decInfo->magic_data);
+    free(decInfo->d_extn_secret_file);
+    decInfo->magic_data = decInfo->d_extn_secret_file = NULL;
+    return status;
+}
+
 // Function definition for decode magic string
 Status_d decode_magic_string(DecodeInfo *decInfo)
 {
-    // Move the fptr - skipping the BMP header (54 bytes).
-    fseek(decInfo->fptr_d_src_image, 54, SEEK_SET);
+    // Move the fptr - skipping the carrier header (54 bytes for BMP).
+    if (!is_bmp_format(decInfo->d_carrier))
+    {
+        uint header_size, capacity;
+        if (!decInfo->d_src_is_stream)
+            fseek(decInfo->fptr_d_src_image, 0, SEEK_SET);
+        if (decInfo->d_carrier->parse_header(decInfo->fptr_d_src_image, &header_size, &capacity) == e_failure)
+            return d_failure;
+    }
+    else if (decInfo->d_src_is_stream)
+    {
+        // A stream can only be read forward
+        char header[54];
+        if (fread(header, 54, 1, decInfo->fptr_d_src_image) != 1)
+            return d_failure;
+    }
+    else
+        fseek(decInfo->fptr_d_src_image, 54, SEEK_SET);
 
     // Determine the length of the magic string.
     int i = strlen(MAGIC_STRING);
 
     /* The size allocated is the length of the MAGIC_STRING + null terminator. */
     decInfo->magic_data = malloc(strlen(MAGIC_STRING) + 1);
+    if (decInfo->magic_data == NULL)
+        return d_failure;
 
     // Decode the data from the image into magic_data.
     decode_data_from_image(strlen(MAGIC_STRING), decInfo->fptr_d_src_image, decInfo);
@@ -176,14 +228,14 @@ Status_d decode_magic_string(DecodeInfo *decInfo)
 
 
 // Function definition for decode file extn size
-Status_d decode_file_extn_size(int size, FILE *fptr_d_src_image)
+Status_d decode_file_extn_size(int size, DecodeInfo *decInfo)
 {
     // Array to hold the encoded data read from the source image.
-    char str[32];
+    char str[32], raw[32 * CARRIER_MAX_STRIDE];
     int length; // Variable to store the decoded file extension size.
 
-    // Read 32 bytes of data from the source image into the str array.
-    fread(str, 32, sizeof(char), fptr_d_src_image);
+    // Read 32 slots of data from the source image into the str array.
+    read_carrier_slots(decInfo->d_carrier, decInfo->fptr_d_src_image, raw, str, 32);
 
     // Decode the size of the file extension from LSB of the read-data.
     decode_size_from_lsb(str, &length);
@@ -208,7 +260,9 @@ Status_d decode_secret_file_extn(char *file_ext, DecodeInfo *decInfo)
     int i = strlen(file_ext); // Get the length of the file extn.
 
     // Allocate memory in the DecodeInfo structure - hold the dec-file etxn.
-    decInfo->d_extn_secret_file = malloc(i + 1); 
+    decInfo->d_extn_secret_file = malloc(i + 1);
+    if (decInfo->d_extn_secret_file == NULL)
+        return d_failure;
 
     // Decode the file extension data from the src image.
     decode_extension_data_from_image(strlen(file_ext), decInfo->fptr_d_src_image, decInfo);
@@ -235,10 +289,11 @@ Status_d decode_secret_file_extn(char *file_ext, DecodeInfo *decInfo)
 Status_d decode_secret_file_size(DecodeInfo *decInfo)
 {
     char buffer[32];  // Buffer to hold 32 bits (4 bytes) for the size
+    char raw[32 * CARRIER_MAX_STRIDE];
     int file_size;
 
     // Read 32 bits (4 bytes) from the image for the secret file size
-    fread(buffer, 32, sizeof(char), decInfo->fptr_d_src_image);
+    read_carrier_slots(decInfo->d_carrier, decInfo->fptr_d_src_image, raw, buffer, 32);
     decode_size_from_lsb(buffer, &file_size);
 
     decInfo->size_secret_file = file_size;  // Store the decoded file size
@@ -253,6 +308,7 @@ Status_d decode_secret_file_size(DecodeInfo *decInfo)
 Status_d decode_secret_file_data(DecodeInfo *decInfo)
 {
     char str[8];  // Buffer to hold 8 bits (1 byte) for decoding
+    char raw[8 * CARRIER_MAX_STRIDE];
     char ch;      // Variable to hold the decoded character
     int stego_file_size = decInfo->size_secret_file; // Use the stored size
     int i;
@@ -262,7 +318,7 @@ Status_d decode_secret_file_data(DecodeInfo *decInfo)
     for (i = 0; i < stego_file_size; i++)
     {
         // Read 8 bits from the source image
-        fread(str, 8, 1, decInfo->fptr_d_src_image);
+        read_carrier_slots(decInfo->d_carrier, decInfo->fptr_d_src_image, raw, str, 8);
         // Decode the byte from the least significant bit
         decode_byte_from_lsb(&ch, str);
         // Write the decoded byte to the secret file
@@ -271,6 +327,7 @@ Status_d decode_secret_file_data(DecodeInfo *decInfo)
         // Display - decoded character
         printf("%c", ch);
     }
+    STEGO_PROBE_BLOCK("decode_secret_file_data", stego_file_size, stego_file_size * 8);
 
     return d_success;
 }
@@ -279,10 +336,10 @@ Status_d decode_secret_file_data(DecodeInfo *decInfo)
 Status_d decode_data_from_image(int size, FILE *fptr_d_src_image, DecodeInfo *decInfo)
 {
     int i;
-    char str[8];
+    char str[8], raw[8 * CARRIER_MAX_STRIDE];
     for (i = 0; i < size; i++)
     {
-        fread(str, 8, sizeof(char), fptr_d_src_image);
+        read_carrier_slots(decInfo->d_carrier, fptr_d_src_image, raw, str, 8);
         decode_byte_from_lsb(&decInfo->magic_data[i], str);
     }
     return d_success;
@@ -318,6 +375,7 @@ Status_d decode_size_from_lsb(char *buffer, int *size)
 Status_d decode_extension_data_from_image(int size, FILE *fptr_d_src_image, DecodeInfo *decInfo)
 {
     char str[8];  // Buffer to hold 8 bits (1 byte) read from - image.
+    char raw[8 * CARRIER_MAX_STRIDE];
     char ch;      // Variable to hold the decoded character.
     int i;        
 
@@ -325,7 +383,7 @@ Status_d decode_extension_data_from_image(int size, FILE *fptr_d_src_image, Deco
     for (i = 0; i < size; i++)
     {
         // Read 8 bits (1 byte) from the source image into the buffer.
-        fread(str, 8, 1, fptr_d_src_image);
+        read_carrier_slots(decInfo->d_carrier, fptr_d_src_image, raw, str, 8);
 
         // Decode the byte from the least significant bit (LSB) and store it in 'ch'.
         decode_byte_from_lsb(&ch, str);
@@ -17,6 +17,8 @@
 #define MAX_SECRET_BUF_SIZE 1                         // Maximum size for the secret data buffer
 #define MAX_IMAGE_BUF_SIZE (MAX_SECRET_BUF_SIZE * 8) // Image buffer size (8 bits for each secret byte)
 
+struct _CarrierFormat;  // carrier.h
+
 // Structure -> decoding information
 
 typedef struct _DecodeInfo
@@ -24,6 +26,8 @@ typedef struct _DecodeInfo
     /* Stego image information */
     char *d_src_image_fname;                 // Filename - source stego image
     FILE *fptr_d_src_image;                 //File pointer - reading the stego image
+    int d_src_is_stream;                    // Stego image is stdin - no seeks allowed
+    const struct _CarrierFormat *d_carrier; // Carrier format (NULL - BMP)
 
     char d_image_data[MAX_IMAGE_BUF_SIZE];  // Buffer to hold - image data
     char *magic_data;                       // Pointer to hold - decoded magic string
@@ -47,6 +51,9 @@ Status_d do_decoding(DecodeInfo *decInfo);
 /* Function to open input and output files for decoding */
 Status_d open_files_dec(DecodeInfo *decInfo);
 
+/* Function to close the files and free the decoded strings */
+Status_d close_files_dec(DecodeInfo *decInfo);
+
 /* Function to decode the magic string from the image */
 Status_d decode_magic_string(DecodeInfo *decInfo);
 
@@ -57,7 +64,7 @@ Status_d decode_data_from_image(int size, FILE *fptr_d_src_image, DecodeInfo *de
 Status_d decode_byte_from_lsb(char *data, char *image_buffer);
 
 /* Function to decode the size of the file extension */
-Status_d decode_file_extn_size(int size, FILE *fptr_d_src_image);
+Status_d decode_file_extn_size(int size, DecodeInfo *decInfo);
 
 /* Function to decode a size value from the least significant bit */
 Status_d decode_size_from_lsb(char *buffer, int *size);
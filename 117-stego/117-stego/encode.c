@@ -7,6 +7,11 @@
 #include "types.h"
 #include <string.h>
 #include "common.h"
+#include "cache.h"
+#include "stream.h"
+#include "probes.h"
+#include "carrier.h"
+#include "arena.h"
 
 /* Function definition for check operation type */
 // Compares the command-line argument with expected flags and returns the appropriate operation type.
@@ -16,6 +21,32 @@ OperationType check_operation_type(char *argv[])
         return e_encode;
     if (strcmp(argv[1], "-d") == 0)
         return e_decode;
+    if (strcmp(argv[1], "-eb") == 0)
+        return e_batch_encode;
+    if (strcmp(argv[1], "-ep") == 0)
+        return e_patch_encode;
+    if (strcmp(argv[1], "-ap") == 0)
+        return e_patch_apply;
+    if (strcmp(argv[1], "-w") == 0)
+        return e_watch_encode;
+    if (strcmp(argv[1], "-eo") == 0)
+        return e_broadcast_encode;
+    if (strcmp(argv[1], "-p") == 0)
+        return e_plan;
+    if (strcmp(argv[1], "-v") == 0)
+        return e_verify;
+    if (strcmp(argv[1], "-ea") == 0)
+        return e_adaptive_encode;
+    if (strcmp(argv[1], "-da") == 0)
+        return e_adaptive_decode;
+    if (strcmp(argv[1], "-bench") == 0)
+        return e_bench;
+    if (strcmp(argv[1], "-a") == 0)
+        return e_append;
+    if (strcmp(argv[1], "-se") == 0)
+        return e_shard_encode;
+    if (strcmp(argv[1], "-sd") == 0)
+        return e_shard_decode;
     else
         return e_unsupported;
 }
@@ -24,20 +55,32 @@ OperationType check_operation_type(char *argv[])
 // Function definition for read and validate encode args
 Status read_and_validate_encode_args(char *argv[], EncodeInfo *encInfo)
 {
-    //Checks the file extensions for BMP ,SH and TXT.
+    // Files are read from disk unless a batch job sets a carrier cache
+    encInfo->carrier_cache = NULL;
+    encInfo->carrier_entry = NULL;
+    encInfo->arena = NULL;
 
-    if (strcmp(strstr(argv[2], "."), ".bmp") == 0)
+    //Checks the file extensions for BMP/WAV ,SH and TXT.
+
+    // "-" reads the src image from stdin, always a BMP
+    if (is_stream_fname(argv[2]))
+        encInfo->carrier = &bmp_format;
+    else
+        encInfo->carrier = find_carrier_format(argv[2]);  // By the last '.' - paths may contain dots
+    if (encInfo->carrier != NULL)
         encInfo->src_image_fname = argv[2];
     else
         return e_failure;
-    if (strcmp(strstr(argv[3], "."), ".txt") == 0)  //  Sets the filenames in the EncodeInfo structure. 
+    if (strrchr(argv[3], '.') != NULL && strcmp(strrchr(argv[3], '.'), ".txt") == 0)  //  Sets the filenames in the EncodeInfo structure. 
         encInfo->secret_fname = argv[3];
     else
         return e_failure;
     if (argv[4] != NULL)
-        encInfo->stego_image_fname = argv[4];
-    else
+        encInfo->stego_image_fname = argv[4];    // "-" writes the stego image to stdout
+    else if (is_bmp_format(encInfo->carrier))
         encInfo->stego_image_fname = "stego.bmp";  //If no stego image name is provided, defaults to "stego.bmp".
+    else
+        encInfo->stego_image_fname = "stego.wav";
     return e_success;
 }
 
@@ -46,42 +89,50 @@ Status read_and_validate_encode_args(char *argv[], EncodeInfo *encInfo)
 Status do_encoding(EncodeInfo *encInfo)
 {
     /*Opens the input files (source image and secret file) and creates the output stego image.*/
-    if (open_files(encInfo) == e_success)
+    if (STEGO_TRACE_STAGE("open_files", open_files(encInfo)) == e_success)
     {
         printf("Open files is a successfully\n");
         /*Checks if the source image has enough capacity to hold the secret data.*/
-        if (check_capacity(encInfo) == e_success)
+        if (STEGO_TRACE_STAGE("check_capacity", check_capacity(encInfo)) == e_success)
         {
             printf("Check capacity is successfully\n");
-            /*Copies the BMP header from the source image to the stego image.[54 LINES]*/
-            if (copy_bmp_header(encInfo->fptr_src_image, encInfo->fptr_stego_image) == e_success)
+            /*Copies the BMP header from the source image to the stego image.[54 LINES]
+              A streamed header was already read by check_capacity, so it is written from memory.*/
+            Status header_status;
+            if (!is_bmp_format(encInfo->carrier))
+                header_status = STEGO_TRACE_STAGE("copy_carrier_header", copy_carrier_header(encInfo->fptr_src_image, encInfo->fptr_stego_image, encInfo->carrier_header_size));
+            else if (encInfo->src_is_stream)
+                header_status = fwrite(encInfo->bmp_header, 54, 1, encInfo->fptr_stego_image) == 1 ? e_success : e_failure;
+            else
+                header_status = STEGO_TRACE_STAGE("copy_bmp_header", copy_bmp_header(encInfo->fptr_src_image, encInfo->fptr_stego_image));
+            if (header_status == e_success)
             {
                 printf("Copied bmp header successfully\n");
                 /*Encodes a predefined magic string into the stego image to identify it later.
                   To encode the magic string into the image.*/
-                if (encode_magic_string(MAGIC_STRING, encInfo) == e_success)
+                if (STEGO_TRACE_STAGE("encode_magic_string", encode_magic_string(MAGIC_STRING, encInfo)) == e_success)
                 {
                     printf("Encoded magic string successfully\n");
                    /* It then copies the substring starting from the period(.)*/
-                    strcpy(encInfo->extn_secret_file, strstr(encInfo->secret_fname, "."));
+                    strcpy(encInfo->extn_secret_file, strrchr(encInfo->secret_fname, '.'));
                     /*Encodes the size of the secret file extension in the image*/
-                    if (encode_secret_file_extn_size(strlen(encInfo->extn_secret_file), encInfo->fptr_src_image, encInfo->fptr_stego_image) == e_success)
+                    if (STEGO_TRACE_STAGE("encode_secret_file_extn_size", encode_secret_file_extn_size(strlen(encInfo->extn_secret_file), encInfo)) == e_success)
                     {
                         printf("Encoded secret file extn size successfully\n");
                         /* Encodes the actual file extension of the secret file*/
-                        if (encode_secret_file_extn(encInfo->extn_secret_file, encInfo) == e_success)
+                        if (STEGO_TRACE_STAGE("encode_secret_file_extn", encode_secret_file_extn(encInfo->extn_secret_file, encInfo)) == e_success)
                         {
                             printf("Encoded secret file extn successfully\n");
                             /*Encodes the size of the secret file in the image.*/
-                            if (encode_secret_file_size(encInfo->size_secret_file, encInfo) == e_success)
+                            if (STEGO_TRACE_STAGE("encode_secret_file_size", encode_secret_file_size(encInfo->size_secret_file, encInfo)) == e_success)
                             {
                                 printf("Encoded secret file size successfully\n");
                                 /*Encodes the contents of the secret file into the stego image*/
-                                if (encode_secret_file_data(encInfo) == e_success)
+                                if (STEGO_TRACE_STAGE("encode_secret_file_data", encode_secret_file_data(encInfo)) == e_success)
                                 {
                                     printf("Encoded secret file data successfully\n");
                                     /* Copies any remaining data from the source image to the stego image after encoding.*/
-                                    if (copy_remaining_img_data(encInfo->fptr_src_image, encInfo->fptr_stego_image) == e_success)
+                                    if (STEGO_TRACE_STAGE("copy_remaining_img_data", copy_remaining_img_data(encInfo->fptr_src_image, encInfo->fptr_stego_image)) == e_success)
                                     {
                                         printf("Copied remaining data successfully\n");
                                     }
@@ -152,8 +203,20 @@ Status do_encoding(EncodeInfo *encInfo)
  */
 Status open_files(EncodeInfo *encInfo)
 {
-    // Src Image file
-    encInfo->fptr_src_image = fopen(encInfo->src_image_fname, "r");
+    // Src Image file - stdin, or served from memory when it is in the carrier cache (BMP only)
+    encInfo->carrier_entry = NULL;
+    encInfo->src_is_stream = is_stream_fname(encInfo->src_image_fname);
+    if (!encInfo->src_is_stream && encInfo->carrier_cache != NULL && is_bmp_format(encInfo->carrier))
+        encInfo->carrier_entry = carrier_cache_get(encInfo->carrier_cache, encInfo->src_image_fname);
+    if (encInfo->src_is_stream)
+        encInfo->fptr_src_image = stdin;
+    else if (encInfo->carrier_entry != NULL)
+        encInfo->fptr_src_image = carrier_cache_open(encInfo->carrier_entry);
+    else
+    {
+        encInfo->fptr_src_image = fopen(encInfo->src_image_fname, "r");
+        set_arena_buffer(encInfo->arena, encInfo->fptr_src_image);
+    }
     // Do Error handling
     if (encInfo->fptr_src_image == NULL)
     {
@@ -163,6 +226,7 @@ Status open_files(EncodeInfo *encInfo)
     }
     // Secret file
     encInfo->fptr_secret = fopen(encInfo->secret_fname, "r");
+    set_arena_buffer(encInfo->arena, encInfo->fptr_secret);
     // Do Error handling
     if (encInfo->fptr_secret == NULL)
     {
@@ -171,7 +235,13 @@ Status open_files(EncodeInfo *encInfo)
         return e_failure;
     }
     // Stego Image file - To write the image data with the embedded secret file.
-    encInfo->fptr_stego_image = fopen(encInfo->stego_image_fname, "w");
+    if (is_stream_fname(encInfo->stego_image_fname))
+        encInfo->fptr_stego_image = open_stdout_stream();
+    else
+    {
+        encInfo->fptr_stego_image = fopen(encInfo->stego_image_fname, "w");
+        set_arena_buffer(encInfo->arena, encInfo->fptr_stego_image);
+    }
     // Do Error handling
     if (encInfo->fptr_stego_image == NULL)
     {
@@ -185,10 +255,125 @@ Status open_files(EncodeInfo *encInfo)
 
 
 
+// Function definition for closing the i/p and o/p files
+Status close_files(EncodeInfo *encInfo)
+{
+    Status status = e_success;
+
+    if (encInfo->fptr_src_image != NULL)
+        fclose(encInfo->fptr_src_image);
+    if (encInfo->fptr_secret != NULL)
+        fclose(encInfo->fptr_secret);
+    // Buffered stego data is written on close, so its result matters
+    if (encInfo->fptr_stego_image != NULL && fclose(encInfo->fptr_stego_image) != 0)
+        status = e_failure;
+    encInfo->fptr_src_image = encInfo->fptr_secret = encInfo->fptr_stego_image = NULL;
+
+    // Unpin the cached src image
+    if (encInfo->carrier_entry != NULL)
+        carrier_cache_release(encInfo->carrier_cache, encInfo->carrier_entry);
+    encInfo->carrier_entry = NULL;
+    return status;
+}
+
+/*
+ * Batch encoding
+ * Input: Job file with one "src.bmp secret.txt stego.bmp" job per line
+ * Description: All jobs run in one process and share a carrier
+ * cache, so carriers used by several jobs are read from disk once.
+ */
+Status do_batch_encoding(char *job_fname, size_t cache_budget)
+{
+    CarrierCache cache;
+    Arena arena;
+    EncodeInfo encInfo;
+    char line[1024], src[320], secret[320], stego[320];
+    int job = 0, failed = 0;
+    FILE *fptr_jobs;
+
+    fptr_jobs = fopen(job_fname, "r");
+    if (fptr_jobs == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", job_fname);
+        return e_failure;
+    }
+    init_carrier_cache(&cache, cache_budget);
+    // Without an arena the jobs just use the heap
+    if (init_arena(&arena, ARENA_DEFAULT_SIZE) == e_failure)
+        memset(&arena, 0, sizeof(Arena));
+
+    while (fgets(line, sizeof(line), fptr_jobs) != NULL)
+    {
+        char *args[] = { "a.out", "-e", src, secret, stego, NULL };
+
+        // Skip blank lines and comments
+        if (sscanf(line, "%319s %319s %319s", src, secret, stego) != 3 || src[0] == '#')
+            continue;
+        job++;
+
+        memset(&encInfo, 0, sizeof(EncodeInfo));
+        if (read_and_validate_encode_args(args, &encInfo) == e_failure)
+        {
+            printf("Job %d: invalid arguments\n", job);
+            failed++;
+            continue;
+        }
+        encInfo.carrier_cache = &cache;
+        encInfo.arena = arena.base != NULL ? &arena : NULL;
+
+        STEGO_PROBE_JOB_START("encode");
+        Status status = do_encoding(&encInfo);
+        if (status == e_success)
+            status = close_files(&encInfo);
+        STEGO_PROBE_JOB_END("encode", status);
+        if (status == e_success)
+        {
+            printf("Job %d: %s -> %s\n", job, src, stego);
+        }
+        else
+        {
+            close_files(&encInfo);
+            printf("Job %d: failed to encode %s\n", job, src);
+            failed++;
+        }
+        // Files are closed, their buffers can be reused by the next job
+        if (encInfo.arena != NULL)
+            reset_arena(&arena);
+    }
+    fclose(fptr_jobs);
+
+    printf("%d job(s), %d failed\n", job, failed);
+    print_carrier_cache_stats(&cache);
+    free_carrier_cache(&cache);
+    if (arena.base != NULL)
+        print_arena_stats(&arena);
+    free_arena(&arena);
+    return failed ? e_failure : e_success;
+}
+
 // Function definition for check capacity
 Status check_capacity(EncodeInfo *encInfo)
 {
-    encInfo->image_capacity = get_image_size_for_bmp(encInfo->fptr_src_image);
+    // Other carrier formats parse their own header, capacity is in slots
+    if (!is_bmp_format(encInfo->carrier))
+    {
+        fseek(encInfo->fptr_src_image, 0, SEEK_SET);
+        if (encInfo->carrier->parse_header(encInfo->fptr_src_image, &encInfo->carrier_header_size, &encInfo->image_capacity) == e_failure)
+            return e_failure;
+    }
+    // A streamed src image can't seek, parse the header as it is read
+    else if (encInfo->src_is_stream)
+    {
+        if (fread(encInfo->bmp_header, 54, 1, encInfo->fptr_src_image) != 1)
+            return e_failure;
+        encInfo->image_capacity = get_image_size_from_header(encInfo->bmp_header);
+    }
+    // A cached src image was parsed when it was loaded
+    else if (encInfo->carrier_entry != NULL)
+        encInfo->image_capacity = encInfo->carrier_entry->image_capacity;
+    else
+        encInfo->image_capacity = get_image_size_for_bmp(encInfo->fptr_src_image);
     encInfo->size_secret_file = get_file_size(encInfo->fptr_secret);
 
 /* TOTAL REQUIRED BITS : 
@@ -238,6 +423,19 @@ uint get_file_size(FILE *fptr)
     return ftell(fptr);    //returns the current position of the file pointer.
 }
 
+/*
+ * Capacity check_capacity needs for a secret:
+ * (magic * 8 + 32 + extn * 8 + 32 + size) * 8, and the image
+ * capacity has to be strictly larger than that
+ */
+unsigned long get_required_capacity(const char *secret_fname, unsigned long size)
+{
+    const char *extn = strrchr(secret_fname, '.');
+    unsigned long extn_size = extn ? strlen(extn) : 0;
+
+    return (strlen(MAGIC_STRING) * 8 + 32 + extn_size * 8 + 32 + size) * 8;
+}
+
 // Function definition for copying 1st 54 bytes header file
 Status copy_bmp_header(FILE *fptr_src_image, FILE *fptr_dest_image)
 {
@@ -265,12 +463,13 @@ Status encode_magic_string(char *magic_string, EncodeInfo *encInfo)
 }
 
 // Function definition for encode secret file extn size
-Status encode_secret_file_extn_size(int size, FILE *fptr_src_image, FILE *fptr_stego_image)
+Status encode_secret_file_extn_size(int size, EncodeInfo *encInfo)
 {
-    char str[32];
-    fread(str, 32, 1, fptr_src_image);
+    char str[32], raw[32 * CARRIER_MAX_STRIDE];
+    read_carrier_slots(encInfo->carrier, encInfo->fptr_src_image, raw, str, 32);
     encode_size_to_lsb(size, str);
-    fwrite(str, 32, 1, fptr_stego_image);
+    write_carrier_slots(encInfo->carrier, encInfo->fptr_stego_image, raw, str, 32);
+    STEGO_PROBE_BLOCK("encode_secret_file_extn_size", 4, 32);
     return e_success;
 }
 
@@ -287,15 +486,17 @@ Status encode_secret_file_extn(char *file_extn, EncodeInfo *encInfo)
 Status encode_secret_file_size(int size, EncodeInfo *encInfo)
 {
     char str[32];  // Temporary buffer to hold data read from the source image
+    char raw[32 * CARRIER_MAX_STRIDE];  // Whole slots, for carriers with wider slots
 
-    // Read 32 bytes from the source image file
-    fread(str, 32, 1, encInfo->fptr_src_image);
+    // Read 32 slots from the source image file
+    read_carrier_slots(encInfo->carrier, encInfo->fptr_src_image, raw, str, 32);
 
     // Encode the size of the secret file into the least significant bits of the read data
     encode_size_to_lsb(size, str);
 
     // Write the modified data back to the stego image file
-    fwrite(str, 32, 1, encInfo->fptr_stego_image);
+    write_carrier_slots(encInfo->carrier, encInfo->fptr_stego_image, raw, str, 32);
+    STEGO_PROBE_BLOCK("encode_secret_file_size", 4, 32);
 
     return e_success; 
 }
@@ -303,17 +504,25 @@ Status encode_secret_file_size(int size, EncodeInfo *encInfo)
 // Function definition for encoding the secret file data into the image
 Status encode_secret_file_data(EncodeInfo *encInfo)
 {
+    // Buffer for one chunk of the secret file data, any file size fits
+    char str[4096];
+    uint remaining = encInfo->size_secret_file;
+
     // Set the file pointer of the secret file to the beginning
     fseek(encInfo->fptr_secret, 0, SEEK_SET);
 
-    // Create a buffer to hold the secret file data
-    char str[encInfo->size_secret_file];
+    while (remaining > 0)
+    {
+        uint n = remaining < sizeof(str) ? remaining : sizeof(str);
 
-    // Read the secret file data into the buffer
-    fread(str, encInfo->size_secret_file, 1, encInfo->fptr_secret);
+        // Read the next chunk of the secret file data into the buffer
+        if (fread(str, 1, n, encInfo->fptr_secret) != n)
+            return e_failure;
 
-    // Encode the secret file data into the source image, modifying the stego image
-    encode_data_to_image(str, strlen(str), encInfo->fptr_src_image, encInfo->fptr_stego_image, encInfo);
+        // Encode the chunk into the source image, modifying the stego image
+        encode_data_to_image(str, n, encInfo->fptr_src_image, encInfo->fptr_stego_image, encInfo);
+        remaining -= n;
+    }
 
     return e_success; 
 }
@@ -321,18 +530,21 @@ Status encode_secret_file_data(EncodeInfo *encInfo)
 // Function definition for encoding data into the image
 Status encode_data_to_image(char *data, int size, FILE *fptr_src_image, FILE *fptr_stego_image, EncodeInfo *encInfo)
 {
+    char raw[MAX_IMAGE_BUF_SIZE * CARRIER_MAX_STRIDE];  // Whole slots, for carriers with wider slots
+
     // Loop through each byte of the data to be encoded
     for (int i = 0; i < size; i++)
     {
-        // Read 8 bits (1 byte) from the source image file into the image_data buffer
-        fread(encInfo->image_data, 8, 1, fptr_src_image);
+        // Read 8 slots (1 byte) from the source image file into the image_data buffer
+        read_carrier_slots(encInfo->carrier, fptr_src_image, raw, encInfo->image_data, 8);
 
         // Encode the current byte of data into the least significant bits of the image data
         encode_byte_to_lsb(data[i], encInfo->image_data);
 
         // Write the modified image data back to the stego image file
-        fwrite(encInfo->image_data, 8, 1, fptr_stego_image);
+        write_carrier_slots(encInfo->carrier, fptr_stego_image, raw, encInfo->image_data, 8);
     }
+    STEGO_PROBE_BLOCK("encode_data_to_image", size, size * 8);
 
     return e_success; 
 }
@@ -388,12 +600,15 @@ Status encode_size_to_lsb(int size, char *image_buffer) {
 Status copy_remaining_img_data(FILE *fptr_src, FILE *fptr_dest)
 {
     char ch;
+    uint count = 0;
     /* read bytes from the source file (fptr_src) until there are no more bytes left to read.  
     Once it reaches the end of the file (where no more bytes can be read), fread will terminate*/
     while ((fread(&ch, 1, 1, fptr_src)) > 0)
     {
         fwrite(&ch, 1, 1, fptr_dest);
+        count++;
     }
+    STEGO_PROBE_BLOCK("copy_remaining_img_data", count, count);
     return e_success;
 }
 
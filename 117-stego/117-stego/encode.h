@@ -18,6 +18,11 @@
 #define MAX_IMAGE_BUF_SIZE (MAX_SECRET_BUF_SIZE * 8)    // Maximum size - based on the secret buffer size.
 #define MAX_FILE_SUFFIX 4                               // Maximum length - file exe => secret file (e.g., .txt).
 
+struct _CarrierCache;   // cache.h
+struct _CarrierEntry;
+struct _CarrierFormat;  // carrier.h
+struct _Arena;          // arena.h
+
 typedef struct _EncodeInfo {
     /* Source Image info */
     char *src_image_fname;                  // Filename - src image
@@ -25,6 +30,10 @@ typedef struct _EncodeInfo {
     uint image_capacity;                    // Capacity of the source image - storing secret data
     uint bits_per_pixel;                    // Number of bits per pixel in the image
     char image_data[MAX_IMAGE_BUF_SIZE];    // Buffer to hold image data
+    char bmp_header[54];                    // Header of a streamed src image (read once)
+    int src_is_stream;                      // Src image is stdin - no seeks allowed
+    const struct _CarrierFormat *carrier;   // Carrier format (NULL - BMP)
+    uint carrier_header_size;               // Bytes copied before the first slot
 
     /* Secret File Info */
     char *secret_fname;                       // Filename - secret file to encode
@@ -36,6 +45,11 @@ typedef struct _EncodeInfo {
     /* Stego Image Info */
     char *stego_image_fname;    // Filename - stego image[o/p]
     FILE *fptr_stego_image;     // File pointer - stego image
+
+    /* Carrier cache info */
+    struct _CarrierCache *carrier_cache;    // Cache to read the src image from (NULL - read from disk)
+    struct _CarrierEntry *carrier_entry;    // Cached src image in use by this job
+    struct _Arena *arena;                   // Per-job arena for file buffers (NULL - heap)
 } EncodeInfo;
 
 /* Encoding function prototype */
@@ -52,6 +66,12 @@ Status do_encoding(EncodeInfo *encInfo);
 /* Get File pointers for i/p and o/p files */
 Status open_files(EncodeInfo *encInfo);
 
+/* Close the i/p and o/p files */
+Status close_files(EncodeInfo *encInfo);
+
+/* Read and run encode jobs from a job file, sharing one carrier cache */
+Status do_batch_encoding(char *job_fname, size_t cache_budget);
+
 /* check capacity */
 Status check_capacity(EncodeInfo *encInfo);
 
@@ -61,6 +81,9 @@ uint get_image_size_for_bmp(FILE *fptr_image);
 /* Get file size */
 uint get_file_size(FILE *fptr);
 
+/* Capacity check_capacity needs for a secret */
+unsigned long get_required_capacity(const char *secret_fname, unsigned long size);
+
 /* Copy bmp image header */
 Status copy_bmp_header(FILE *fptr_src_image, FILE *fptr_dest_image);
 
@@ -68,7 +91,7 @@ Status copy_bmp_header(FILE *fptr_src_image, FILE *fptr_dest_image);
 Status encode_magic_string(char *magic_string, EncodeInfo *encInfo);
 
 /* Encode Secret file extn size */
-Status encode_secret_file_extn_size(int size, FILE *fptr_src_image, FILE *fptr_stego_image);
+Status encode_secret_file_extn_size(int size, EncodeInfo *encInfo);
 
 /* Encode secret file extenstion */
 Status encode_secret_file_extn(char *file_extn, EncodeInfo *encInfo);
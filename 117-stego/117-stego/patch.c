@@ -0,0 +1,457 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : PATCH OUTPUT (patch.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "patch.h"
+#include "encode.h"
+#include "common.h"
+#include "stream.h"
+#include "types.h"
+
+// Function definition for read and validate patch encode args
+Status read_and_validate_patch_encode_args(char *argv[], PatchInfo *patInfo)
+{
+    memset(patInfo, 0, sizeof(PatchInfo));
+
+    if (argv[2] == NULL || argv[3] == NULL || argv[4] == NULL)
+    {
+        printf("Error: Usage ./a.out -ep cover.bmp secret.txt out.patch\n");
+        return e_failure;
+    }
+    if (strstr(argv[2], ".") == NULL || strcmp(strstr(argv[2], "."), ".bmp") != 0)
+    {
+        printf("Error: Cover image is not a .bmp file\n");
+        return e_failure;
+    }
+    // Same secret file check as -e
+    if (strrchr(argv[3], '.') == NULL || strcmp(strrchr(argv[3], '.'), ".txt") != 0)
+    {
+        printf("Error: Secret file is not a .txt file\n");
+        return e_failure;
+    }
+    patInfo->cover_image_fname = argv[2];
+    patInfo->secret_fname = argv[3];
+    patInfo->patch_fname = argv[4];
+    return e_success;
+}
+
+// Function definition for read and validate patch apply args
+Status read_and_validate_patch_apply_args(char *argv[], PatchInfo *patInfo)
+{
+    memset(patInfo, 0, sizeof(PatchInfo));
+
+    if (argv[2] == NULL || argv[3] == NULL)
+    {
+        printf("Error: Usage ./a.out -ap cover.bmp in.patch [stego.bmp]\n");
+        return e_failure;
+    }
+    if (strstr(argv[2], ".") == NULL || strcmp(strstr(argv[2], "."), ".bmp") != 0)
+    {
+        printf("Error: Cover image is not a .bmp file\n");
+        return e_failure;
+    }
+    patInfo->cover_image_fname = argv[2];
+    patInfo->patch_fname = argv[3];
+    if (argv[4] != NULL)
+        patInfo->stego_image_fname = argv[4];
+    else
+        patInfo->stego_image_fname = "stego.bmp";  // Same default as -e
+    return e_success;
+}
+
+// Function definition for the cover header checksum
+uint patch_header_checksum(FILE *fptr_image)
+{
+    unsigned char header[54];
+    uint hash = 2166136261u;    // FNV-1a offset basis
+
+    fseek(fptr_image, 0, SEEK_SET);
+    if (fread(header, 54, 1, fptr_image) != 1)
+        return 0;
+    for (int i = 0; i < 54; i++)
+        hash = (hash ^ header[i]) * 16777619u;
+    return hash;
+}
+
+/* Write a 32 bit patch field, little-endian like the BMP/WAV headers */
+static void write_patch_le32(FILE *fptr, uint value)
+{
+    unsigned char bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+
+    fwrite(bytes, sizeof(bytes), 1, fptr);
+}
+
+/* Read a little-endian 32 bit patch field */
+static Status read_patch_le32(FILE *fptr, uint *value)
+{
+    unsigned char bytes[4];
+
+    if (fread(bytes, sizeof(bytes), 1, fptr) != 1)
+        return e_failure;
+    *value = bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint)bytes[3] << 24;
+    return e_success;
+}
+
+// Function definition for writing the current run
+Status flush_patch_run(PatchInfo *patInfo)
+{
+    if (patInfo->run_length == 0)
+        return e_success;
+
+    write_patch_le32(patInfo->fptr_patch, patInfo->run_offset);
+    write_patch_le32(patInfo->fptr_patch, patInfo->run_length);
+    fwrite(patInfo->run_bits, (patInfo->run_length + 7) / 8, 1, patInfo->fptr_patch);
+    patInfo->run_count++;
+
+    patInfo->run_length = 0;
+    memset(patInfo->run_bits, 0, patInfo->run_bits_size);
+    return e_success;
+}
+
+/* Append the LSB of one stego byte to the current run */
+static Status patch_run_append(PatchInfo *patInfo, unsigned char stego_byte)
+{
+    uint i = patInfo->run_length;
+
+    if (i / 8 >= patInfo->run_bits_size)
+    {
+        uint size = patInfo->run_bits_size ? patInfo->run_bits_size * 2 : 4096;
+        unsigned char *bits = realloc(patInfo->run_bits, size);
+
+        if (bits == NULL)
+            return e_failure;
+        memset(bits + patInfo->run_bits_size, 0, size - patInfo->run_bits_size);
+        patInfo->run_bits = bits;
+        patInfo->run_bits_size = size;
+    }
+    patInfo->run_bits[i / 8] |= (stego_byte & 0x01) << (7 - i % 8);
+    patInfo->run_length++;
+    return e_success;
+}
+
+/* Add one cover/stego byte pair at diff_offset to the runs */
+static Status patch_diff_byte(PatchInfo *patInfo, unsigned char cover, unsigned char stego)
+{
+    uint offset = patInfo->diff_offset++;
+    int changed = (cover ^ stego) & 0x01;
+
+    if (patInfo->in_run)
+    {
+        // Gap too long, close the run at the last changed byte
+        if (!changed && offset - patInfo->last_changed > PATCH_MAX_GAP)
+        {
+            patInfo->run_length = patInfo->last_changed - patInfo->run_offset + 1;
+            patInfo->in_run = 0;
+            return flush_patch_run(patInfo);
+        }
+        if (patch_run_append(patInfo, stego) == e_failure)
+            return e_failure;
+    }
+    else if (changed)
+    {
+        patInfo->run_offset = offset;
+        patInfo->in_run = 1;
+        if (patch_run_append(patInfo, stego) == e_failure)
+            return e_failure;
+    }
+    if (changed)
+        patInfo->last_changed = offset;
+    return e_success;
+}
+
+/* Embed size bytes into the next cover slots, same as encode_data_to_image */
+static Status patch_embed_bytes(PatchInfo *patInfo, const char *data, uint size)
+{
+    char cover[PATCH_BLOCK_SIZE], stego[PATCH_BLOCK_SIZE];
+
+    while (size > 0)
+    {
+        uint n = size < PATCH_BLOCK_SIZE / 8 ? size : PATCH_BLOCK_SIZE / 8;
+
+        if (fread(cover, 8, n, patInfo->fptr_cover_image) != n)
+        {
+            printf("Error: Cover image is truncated\n");
+            return e_failure;
+        }
+        memcpy(stego, cover, n * 8);
+        for (uint i = 0; i < n; i++)
+            encode_byte_to_lsb(data[i], stego + i * 8);
+        for (uint i = 0; i < n * 8; i++)
+            if (patch_diff_byte(patInfo, cover[i], stego[i]) == e_failure)
+                return e_failure;
+        data += n;
+        size -= n;
+    }
+    return e_success;
+}
+
+/* Embed a 32 bit size into the next cover slots, same as encode_secret_file_size */
+static Status patch_embed_size(PatchInfo *patInfo, uint size)
+{
+    char cover[32], stego[32];
+
+    if (fread(cover, sizeof(cover), 1, patInfo->fptr_cover_image) != 1)
+    {
+        printf("Error: Cover image is truncated\n");
+        return e_failure;
+    }
+    memcpy(stego, cover, sizeof(cover));
+    encode_size_to_lsb(size, stego);
+    for (uint i = 0; i < sizeof(cover); i++)
+        if (patch_diff_byte(patInfo, cover[i], stego[i]) == e_failure)
+            return e_failure;
+    return e_success;
+}
+
+/*
+ * Write the runs
+ * Description: The stego header and the secret data are embedded
+ * into the cover slots in memory, in the same order as do_encoding.
+ * Only the slot region is read, the BMP header and the pixels after
+ * the payload never change and are not looked at.
+ */
+Status write_patch_runs(PatchInfo *patInfo)
+{
+    char data[PATCH_BLOCK_SIZE / 8];
+    const char *extn = strrchr(patInfo->secret_fname, '.');
+    uint remaining = patInfo->size_secret_file;
+
+    fseek(patInfo->fptr_cover_image, BMP_HEADER_SIZE, SEEK_SET);
+    fseek(patInfo->fptr_secret, 0, SEEK_SET);
+    patInfo->diff_offset = BMP_HEADER_SIZE;
+    patInfo->in_run = 0;
+
+    if (patch_embed_bytes(patInfo, MAGIC_STRING, strlen(MAGIC_STRING)) == e_failure ||
+        patch_embed_size(patInfo, strlen(extn)) == e_failure ||
+        patch_embed_bytes(patInfo, extn, strlen(extn)) == e_failure ||
+        patch_embed_size(patInfo, patInfo->size_secret_file) == e_failure)
+        return e_failure;
+
+    while (remaining > 0)
+    {
+        uint n = remaining < sizeof(data) ? remaining : sizeof(data);
+
+        if (fread(data, 1, n, patInfo->fptr_secret) != n)
+        {
+            printf("Error: Unable to read secret file %s\n", patInfo->secret_fname);
+            return e_failure;
+        }
+        if (patch_embed_bytes(patInfo, data, n) == e_failure)
+            return e_failure;
+        remaining -= n;
+    }
+
+    if (patInfo->in_run)
+    {
+        patInfo->run_length = patInfo->last_changed - patInfo->run_offset + 1;
+        patInfo->in_run = 0;
+        flush_patch_run(patInfo);
+    }
+    return e_success;
+}
+
+// Function definition for do patch encoding
+Status do_patch_encoding(PatchInfo *patInfo)
+{
+    uint image_capacity;
+    Status status = e_failure;
+
+    patInfo->fptr_cover_image = fopen(patInfo->cover_image_fname, "r");
+    patInfo->fptr_secret = fopen(patInfo->secret_fname, "r");
+    patInfo->fptr_patch = fopen(patInfo->patch_fname, "w");
+    if (patInfo->fptr_cover_image == NULL || patInfo->fptr_secret == NULL || patInfo->fptr_patch == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open files for the patch\n");
+        goto out;
+    }
+
+    /* Same capacity check as -e */
+    image_capacity = get_image_size_for_bmp(patInfo->fptr_cover_image);
+    patInfo->size_secret_file = get_file_size(patInfo->fptr_secret);
+    if (image_capacity <= get_required_capacity(patInfo->secret_fname, patInfo->size_secret_file))
+    {
+        printf("Error: Cover image %s can't hold %s\n", patInfo->cover_image_fname, patInfo->secret_fname);
+        goto out;
+    }
+
+    patInfo->header_checksum = patch_header_checksum(patInfo->fptr_cover_image);
+    patInfo->cover_size = get_file_size(patInfo->fptr_cover_image);
+    fwrite(PATCH_MAGIC, strlen(PATCH_MAGIC), 1, patInfo->fptr_patch);
+    write_patch_le32(patInfo->fptr_patch, patInfo->header_checksum);
+    write_patch_le32(patInfo->fptr_patch, patInfo->cover_size);
+
+    if (write_patch_runs(patInfo) == e_failure)
+    {
+        printf("Failed to write patch runs\n");
+        goto out;
+    }
+    // End run
+    write_patch_le32(patInfo->fptr_patch, 0);
+    write_patch_le32(patInfo->fptr_patch, 0);
+    status = e_success;
+
+out:
+    if (patInfo->fptr_cover_image)
+        fclose(patInfo->fptr_cover_image);
+    if (patInfo->fptr_secret)
+        fclose(patInfo->fptr_secret);
+    if (patInfo->fptr_patch && fclose(patInfo->fptr_patch) != 0)
+        status = e_failure;
+    free(patInfo->run_bits);
+
+    if (status == e_success)
+        printf("Wrote %u run(s) to %s\n", patInfo->run_count, patInfo->patch_fname);
+    return status;
+}
+
+// Function definition for copying a block of image data
+Status copy_image_block(FILE *fptr_src, FILE *fptr_dest, uint size)
+{
+    char buffer[PATCH_BLOCK_SIZE];
+
+    while (size > 0)
+    {
+        size_t n = size < PATCH_BLOCK_SIZE ? size : PATCH_BLOCK_SIZE;
+
+        if (fread(buffer, 1, n, fptr_src) != n)
+            return e_failure;
+        fwrite(buffer, 1, n, fptr_dest);
+        size -= n;
+    }
+    return e_success;
+}
+
+// Function definition for do patch apply
+Status do_patch_apply(PatchInfo *patInfo)
+{
+    char magic[sizeof(PATCH_MAGIC)];
+    uint header_checksum, cover_size, position = 0;
+    unsigned char *run_data = NULL;
+    size_t run_data_size = 0;
+    Status status = e_failure;
+
+    patInfo->fptr_cover_image = fopen(patInfo->cover_image_fname, "r");
+    patInfo->fptr_patch = fopen(patInfo->patch_fname, "r");
+    if (patInfo->fptr_cover_image == NULL || patInfo->fptr_patch == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open files for the patch\n");
+        goto out;
+    }
+
+    /* The patch must have been made against this cover */
+    if (fread(magic, strlen(PATCH_MAGIC), 1, patInfo->fptr_patch) != 1 ||
+        read_patch_le32(patInfo->fptr_patch, &header_checksum) == e_failure ||
+        read_patch_le32(patInfo->fptr_patch, &cover_size) == e_failure)
+    {
+        printf("Error: Patch file is truncated\n");
+        goto out;
+    }
+    magic[strlen(PATCH_MAGIC)] = '\0';
+    if (strcmp(magic, PATCH_MAGIC) != 0)
+    {
+        printf("Error: %s is not a patch file\n", patInfo->patch_fname);
+        goto out;
+    }
+    if (header_checksum != patch_header_checksum(patInfo->fptr_cover_image) ||
+        cover_size != get_file_size(patInfo->fptr_cover_image))
+    {
+        printf("Error: Patch was not made for cover image %s\n", patInfo->cover_image_fname);
+        goto out;
+    }
+    fseek(patInfo->fptr_cover_image, 0, SEEK_SET);
+
+    patInfo->fptr_stego_image = fopen(patInfo->stego_image_fname, "w");
+    if (patInfo->fptr_stego_image == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", patInfo->stego_image_fname);
+        goto out;
+    }
+
+    /* Copy the cover in blocks, rewriting LSBs inside each run */
+    while (1)
+    {
+        size_t bits_size;
+
+        if (read_patch_le32(patInfo->fptr_patch, &patInfo->run_offset) == e_failure ||
+            read_patch_le32(patInfo->fptr_patch, &patInfo->run_length) == e_failure)
+        {
+            printf("Error: Patch file is truncated\n");
+            goto out;
+        }
+        if (patInfo->run_length == 0)
+            break;
+        // Runs come from the patch file, checked without wrapping
+        if (patInfo->run_offset < position || patInfo->run_length > cover_size ||
+            patInfo->run_offset > cover_size - patInfo->run_length)
+        {
+            printf("Error: Invalid run at offset %u\n", patInfo->run_offset);
+            goto out;
+        }
+
+        // Run data followed by its packed bits
+        bits_size = ((size_t)patInfo->run_length + 7) / 8;
+        if ((size_t)patInfo->run_length > SIZE_MAX - bits_size)
+        {
+            printf("Error: Invalid run at offset %u\n", patInfo->run_offset);
+            goto out;
+        }
+        if (patInfo->run_length + bits_size > run_data_size)
+        {
+            free(run_data);
+            run_data_size = patInfo->run_length + bits_size;
+            run_data = malloc(run_data_size);
+            if (run_data == NULL)
+                goto out;
+        }
+        if (fread(run_data + patInfo->run_length, bits_size, 1, patInfo->fptr_patch) != 1)
+        {
+            printf("Error: Patch file is truncated\n");
+            goto out;
+        }
+
+        if (copy_image_block(patInfo->fptr_cover_image, patInfo->fptr_stego_image, patInfo->run_offset - position) == e_failure ||
+            fread(run_data, patInfo->run_length, 1, patInfo->fptr_cover_image) != 1)
+        {
+            printf("Error: Cover image is truncated\n");
+            goto out;
+        }
+        for (uint i = 0; i < patInfo->run_length; i++)
+        {
+            unsigned char bit = (run_data[patInfo->run_length + i / 8] >> (7 - i % 8)) & 0x01;
+
+            run_data[i] = (run_data[i] & 0xFE) | bit;
+        }
+        fwrite(run_data, patInfo->run_length, 1, patInfo->fptr_stego_image);
+
+        position = patInfo->run_offset + patInfo->run_length;
+        patInfo->run_count++;
+    }
+
+    /* Remaining cover bytes are unchanged */
+    if (copy_image_block(patInfo->fptr_cover_image, patInfo->fptr_stego_image, cover_size - position) == e_failure)
+    {
+        printf("Error: Cover image is truncated\n");
+        goto out;
+    }
+    status = e_success;
+
+out:
+    if (patInfo->fptr_cover_image)
+        fclose(patInfo->fptr_cover_image);
+    if (patInfo->fptr_patch)
+        fclose(patInfo->fptr_patch);
+    if (patInfo->fptr_stego_image && fclose(patInfo->fptr_stego_image) != 0)
+        status = e_failure;
+    free(run_data);
+
+    if (status == e_success)
+        printf("Applied %u run(s) to %s\n", patInfo->run_count, patInfo->stego_image_fname);
+    return status;
+}
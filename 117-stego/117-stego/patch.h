@@ -0,0 +1,79 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : PATCH OUTPUT (patch.h) */
+
+#ifndef PATCH_H
+#define PATCH_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * Instead of a full stego image, a patch holds only the LSBs that
+ * differ from the cover image:
+ *
+ *   "STGP" | cover header checksum | cover size | runs... | end run
+ *
+ * Each run is (offset, length, LSB bits packed 8 per byte, MSB first).
+ * Checksum, size, offset and length are 32 bit little-endian.
+ * Changed bytes closer than PATCH_MAX_GAP are merged into one run.
+ * An end run has length 0. The runs are built by embedding the payload
+ * into the cover slots in memory, no stego image is written.
+ */
+
+#define PATCH_MAGIC "STGP"          // Identifies a patch file
+#define PATCH_MAX_GAP 32            // Unchanged bytes allowed inside a run
+#define PATCH_BLOCK_SIZE 65536      // I/O block size for diff and apply
+
+typedef struct _PatchInfo {
+    char *cover_image_fname;    // Filename - cover image (already at the edge site)
+    FILE *fptr_cover_image;     // File pointer - cover image
+    char *secret_fname;         // Filename - secret file (encode only)
+    FILE *fptr_secret;          // File pointer - secret file
+    uint size_secret_file;      // Size of the secret file in bytes
+    char *patch_fname;          // Filename - patch file
+    FILE *fptr_patch;           // File pointer - patch file
+    char *stego_image_fname;    // Filename - stego image (apply only)
+    FILE *fptr_stego_image;     // File pointer - stego image
+
+    uint header_checksum;       // Checksum of the cover BMP header
+    uint cover_size;            // Size of the cover image in bytes
+
+    /* Run being built / applied */
+    uint run_offset;            // Carrier offset of the first byte in the run
+    uint run_length;            // Number of carrier bytes covered by the run
+    unsigned char *run_bits;    // Packed LSB bits of the run
+    uint run_bits_size;         // Allocated size of run_bits
+    uint run_count;             // Number of runs written
+    uint diff_offset;           // Carrier offset of the next embedded byte
+    uint last_changed;          // Carrier offset of the last changed LSB
+    int in_run;                 // A run is being built
+} PatchInfo;
+
+/* Patch function prototypes */
+
+/* Read and validate patch encode args: -ep <cover.bmp> <secret.txt> <out.patch> */
+Status read_and_validate_patch_encode_args(char *argv[], PatchInfo *patInfo);
+
+/* Read and validate patch apply args: -ap <cover.bmp> <in.patch> <stego.bmp> */
+Status read_and_validate_patch_apply_args(char *argv[], PatchInfo *patInfo);
+
+/* Write the patch of the secret file against the cover */
+Status do_patch_encoding(PatchInfo *patInfo);
+
+/* Rebuild the stego image from the cover and the patch */
+Status do_patch_apply(PatchInfo *patInfo);
+
+/* Checksum (FNV-1a) of the cover BMP header */
+uint patch_header_checksum(FILE *fptr_image);
+
+/* Embed the stego header and secret data and write the changed LSBs as runs */
+Status write_patch_runs(PatchInfo *patInfo);
+
+/* Write the run being built to the patch file */
+Status flush_patch_run(PatchInfo *patInfo);
+
+/* Copy size bytes from src to dest in blocks */
+Status copy_image_block(FILE *fptr_src, FILE *fptr_dest, uint size);
+
+#endif
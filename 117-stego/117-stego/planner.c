@@ -0,0 +1,327 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : CARRIER PLANNER (planner.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "planner.h"
+#include "encode.h"
+#include "stream.h"
+#include "common.h"
+#include "types.h"
+
+// Function definition for read and validate planner args
+Status read_and_validate_plan_args(char *argv[], PlanInfo *pInfo)
+{
+    memset(pInfo, 0, sizeof(PlanInfo));
+
+    if (argv[2] == NULL || argv[3] == NULL)
+    {
+        printf("Error: Usage ./a.out -p secrets.lst carriers.lst [manifest.txt]\n");
+        return e_failure;
+    }
+    pInfo->secret_list_fname = argv[2];
+    pInfo->carrier_list_fname = argv[3];
+    if (argv[4] != NULL)
+        pInfo->manifest_fname = argv[4];
+    else
+        pInfo->manifest_fname = "manifest.txt";  // Default, usable with -eb
+    return e_success;
+}
+
+/* Free a path list and every path in it */
+static void free_path_list(char **paths, int count)
+{
+    for (int i = 0; i < count; i++)
+        free(paths[i]);
+    free(paths);
+}
+
+/* Read one path per line, skipping blank lines. count is -1 on error */
+static char **read_path_list(const char *list_fname, int *count)
+{
+    char line[1024];
+    char **paths = NULL;
+    int size = 0;
+    FILE *fptr;
+
+    *count = 0;
+    fptr = fopen(list_fname, "r");
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", list_fname);
+        *count = -1;
+        return NULL;
+    }
+    while (fgets(line, sizeof(line), fptr) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0')
+            continue;
+        if (*count == size)
+        {
+            char **grown;
+
+            size = size ? size * 2 : 1024;
+            grown = realloc(paths, size * sizeof(char *));
+            if (grown == NULL)
+                goto error;
+            paths = grown;
+        }
+        paths[*count] = strdup(line);
+        if (paths[*count] == NULL)
+            goto error;
+        (*count)++;
+    }
+    fclose(fptr);
+    return paths;
+
+error:
+    printf("Error: Unable to allocate the paths of %s\n", list_fname);
+    fclose(fptr);
+    free_path_list(paths, *count);
+    *count = -1;
+    return NULL;
+}
+
+// Function definition for reading the secret sizes
+Status read_plan_secrets(PlanInfo *pInfo)
+{
+    char **paths = read_path_list(pInfo->secret_list_fname, &pInfo->secret_count);
+    struct stat st;
+
+    if (pInfo->secret_count < 0)
+    {
+        pInfo->secret_count = 0;
+        return e_failure;
+    }
+    pInfo->secrets = calloc(pInfo->secret_count ? pInfo->secret_count : 1, sizeof(PlanSecret));
+    if (pInfo->secrets == NULL)
+    {
+        free_path_list(paths, pInfo->secret_count);
+        pInfo->secret_count = 0;
+        return e_failure;
+    }
+    // The paths belong to the secrets from here on, free_plan_info releases them
+    for (int i = 0; i < pInfo->secret_count; i++)
+        pInfo->secrets[i].fname = paths[i];
+    free(paths);
+
+    for (int i = 0; i < pInfo->secret_count; i++)
+    {
+        PlanSecret *secret = &pInfo->secrets[i];
+
+        secret->carrier = -1;
+        // Same check as read_and_validate_encode_args, -eb would reject the job
+        if (strrchr(secret->fname, '.') == NULL || strcmp(strrchr(secret->fname, '.'), ".txt") != 0)
+        {
+            printf("Error: %s is not a .txt file\n", secret->fname);
+            return e_failure;
+        }
+        if (stat(secret->fname, &st) != 0)
+        {
+            perror("stat");
+            fprintf(stderr, "ERROR: Unable to stat file %s\n", secret->fname);
+            return e_failure;
+        }
+        secret->size = st.st_size;
+        secret->required = get_required_capacity(secret->fname, secret->size);
+    }
+    return e_success;
+}
+
+// Function definition for reading the carrier capacities
+Status read_plan_carriers(PlanInfo *pInfo)
+{
+    char **paths = read_path_list(pInfo->carrier_list_fname, &pInfo->carrier_count);
+    char header[BMP_HEADER_SIZE];
+    struct stat st;
+
+    if (pInfo->carrier_count < 0)
+    {
+        pInfo->carrier_count = 0;
+        return e_failure;
+    }
+    pInfo->carriers = calloc(pInfo->carrier_count ? pInfo->carrier_count : 1, sizeof(PlanCarrier));
+    if (pInfo->carriers == NULL)
+    {
+        free_path_list(paths, pInfo->carrier_count);
+        pInfo->carrier_count = 0;
+        return e_failure;
+    }
+    for (int i = 0; i < pInfo->carrier_count; i++)
+        pInfo->carriers[i].fname = paths[i];
+    free(paths);
+
+    for (int i = 0; i < pInfo->carrier_count; i++)
+    {
+        PlanCarrier *carrier = &pInfo->carriers[i];
+        int fd;
+
+
+        // Only the header is needed, skip stdio buffering
+        fd = open(carrier->fname, O_RDONLY);
+        if (fd == -1 || fstat(fd, &st) != 0 || pread(fd, header, BMP_HEADER_SIZE, 0) != BMP_HEADER_SIZE)
+        {
+            perror("open");
+            fprintf(stderr, "ERROR: Unable to read BMP header of %s\n", carrier->fname);
+            if (fd != -1)
+                close(fd);
+            return e_failure;
+        }
+        close(fd);
+        carrier->capacity = bmp_header_capacity(header);
+        carrier->file_size = st.st_size;
+    }
+    return e_success;
+}
+
+static int compare_secret_desc(const void *a, const void *b)
+{
+    const PlanSecret *x = a, *y = b;
+
+    return (x->required < y->required) - (x->required > y->required);
+}
+
+static int compare_carrier_asc(const void *a, const void *b)
+{
+    const PlanCarrier *x = a, *y = b;
+
+    if (x->capacity != y->capacity)
+        return (x->capacity > y->capacity) - (x->capacity < y->capacity);
+    return (x->file_size > y->file_size) - (x->file_size < y->file_size);
+}
+
+/* First free carrier at or after index i (carrier_count if none) */
+static int find_free_carrier(int *next_free, int i)
+{
+    while (next_free[i] != i)
+    {
+        next_free[i] = next_free[next_free[i]];    // Path halving
+        i = next_free[i];
+    }
+    return i;
+}
+
+// Function definition for best-fit decreasing assignment
+Status assign_plan(PlanInfo *pInfo)
+{
+    int i;
+
+    qsort(pInfo->secrets, pInfo->secret_count, sizeof(PlanSecret), compare_secret_desc);
+    qsort(pInfo->carriers, pInfo->carrier_count, sizeof(PlanCarrier), compare_carrier_asc);
+
+    pInfo->next_free = malloc((pInfo->carrier_count + 1) * sizeof(int));
+    if (pInfo->next_free == NULL)
+        return e_failure;
+    for (i = 0; i <= pInfo->carrier_count; i++)
+        pInfo->next_free[i] = i;
+
+    for (i = 0; i < pInfo->secret_count; i++)
+    {
+        PlanSecret *secret = &pInfo->secrets[i];
+        int low = 0, high = pInfo->carrier_count, c;
+
+        // Smallest carrier with capacity > required
+        while (low < high)
+        {
+            int mid = low + (high - low) / 2;
+
+            if (pInfo->carriers[mid].capacity > secret->required)
+                high = mid;
+            else
+                low = mid + 1;
+        }
+
+        c = find_free_carrier(pInfo->next_free, low);
+        if (c == pInfo->carrier_count)
+        {
+            pInfo->unassigned++;
+            continue;
+        }
+        secret->carrier = c;
+        pInfo->next_free[c] = c + 1;    // Taken, skip to the next one
+        pInfo->total_bytes += pInfo->carriers[c].file_size;
+    }
+    return e_success;
+}
+
+// Function definition for writing the job manifest
+Status write_plan_manifest(PlanInfo *pInfo)
+{
+    FILE *fptr = fopen(pInfo->manifest_fname, "w");
+
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", pInfo->manifest_fname);
+        return e_failure;
+    }
+
+    fprintf(fptr, "# carrier secret stego - %d secret(s), %d carrier(s), %lu carrier bytes\n",
+            pInfo->secret_count, pInfo->carrier_count, pInfo->total_bytes);
+    for (int i = 0; i < pInfo->secret_count; i++)
+    {
+        PlanSecret *secret = &pInfo->secrets[i];
+        const char *extn = strrchr(secret->fname, '.');
+        int stem = extn ? (int)(extn - secret->fname) : (int)strlen(secret->fname);
+
+        if (secret->carrier == -1)
+            fprintf(fptr, "# unassigned %s (%lu bytes)\n", secret->fname, secret->size);
+        else
+            fprintf(fptr, "%s %s %.*s_stego.bmp\n", pInfo->carriers[secret->carrier].fname,
+                    secret->fname, stem, secret->fname);
+    }
+    if (fclose(fptr) != 0)
+        return e_failure;
+    return e_success;
+}
+
+// Function definition for do planning
+Status do_planning(PlanInfo *pInfo)
+{
+    if (read_plan_secrets(pInfo) == e_failure)
+    {
+        printf("Failed to read secret sizes\n");
+        return e_failure;
+    }
+    if (read_plan_carriers(pInfo) == e_failure)
+    {
+        printf("Failed to read carrier capacities\n");
+        return e_failure;
+    }
+    printf("%d secret(s), %d carrier(s)\n", pInfo->secret_count, pInfo->carrier_count);
+
+    if (assign_plan(pInfo) == e_failure)
+    {
+        printf("Failed to assign carriers\n");
+        return e_failure;
+    }
+    if (write_plan_manifest(pInfo) == e_failure)
+    {
+        printf("Failed to write manifest %s\n", pInfo->manifest_fname);
+        return e_failure;
+    }
+
+    printf("Assigned %d secret(s), %d unassigned, %lu carrier bytes -> %s\n",
+           pInfo->secret_count - pInfo->unassigned, pInfo->unassigned, pInfo->total_bytes, pInfo->manifest_fname);
+    return e_success;
+}
+
+// Function definition for releasing the planner buffers
+void free_plan_info(PlanInfo *pInfo)
+{
+    for (int i = 0; i < pInfo->secret_count; i++)
+        free(pInfo->secrets[i].fname);
+    for (int i = 0; i < pInfo->carrier_count; i++)
+        free(pInfo->carriers[i].fname);
+    free(pInfo->secrets);
+    free(pInfo->carriers);
+    free(pInfo->next_free);
+    memset(pInfo, 0, sizeof(PlanInfo));
+}
@@ -0,0 +1,72 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : CARRIER PLANNER (planner.h) */
+
+#ifndef PLANNER_H
+#define PLANNER_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * Assign N secrets to a pool of M carriers, one secret per carrier.
+ * Best-fit decreasing: secrets are taken largest first and each gets
+ * the smallest free carrier that passes check_capacity. With one
+ * secret per carrier this minimises the total carrier bytes read and
+ * written. Free carriers are found with a binary search plus a
+ * "next free" union-find, so planning is O((N + M) log M).
+ * The manifest uses the -eb job file format.
+ */
+
+typedef struct _PlanSecret {
+    char *fname;                // Secret file
+    unsigned long size;         // Size in bytes
+    unsigned long required;     // Image capacity check_capacity needs
+    int carrier;                // Assigned carrier (index into sorted carriers), -1 if none
+} PlanSecret;
+
+typedef struct _PlanCarrier {
+    char *fname;                // Carrier image
+    unsigned long capacity;     // Capacity as per get_image_size_for_bmp
+    unsigned long file_size;    // Bytes read and written to encode it
+} PlanCarrier;
+
+typedef struct _PlanInfo {
+    char *secret_list_fname;    // File with one secret path per line
+    char *carrier_list_fname;   // File with one carrier path per line
+    char *manifest_fname;       // O/p job manifest
+
+    PlanSecret *secrets;
+    int secret_count;
+    PlanCarrier *carriers;
+    int carrier_count;
+    int *next_free;             // Union-find over sorted carriers (carrier_count + 1 entries)
+
+    unsigned long total_bytes;  // Carrier bytes of the plan
+    int unassigned;             // Secrets that fit no free carrier
+} PlanInfo;
+
+/* Planner function prototypes */
+
+/* Read and validate planner args: -p <secrets.lst> <carriers.lst> [manifest.txt] */
+Status read_and_validate_plan_args(char *argv[], PlanInfo *pInfo);
+
+/* Read sizes, compute the assignment and write the manifest */
+Status do_planning(PlanInfo *pInfo);
+
+/* Read the secret sizes */
+Status read_plan_secrets(PlanInfo *pInfo);
+
+/* Read the carrier capacities from their BMP headers */
+Status read_plan_carriers(PlanInfo *pInfo);
+
+/* Best-fit decreasing assignment */
+Status assign_plan(PlanInfo *pInfo);
+
+/* Write the job manifest */
+Status write_plan_manifest(PlanInfo *pInfo);
+
+/* Release the planner buffers */
+void free_plan_info(PlanInfo *pInfo);
+
+#endif
@@ -0,0 +1,50 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : USDT TRACEPOINTS (probes.h) */
+
+#ifndef PROBES_H
+#define PROBES_H
+
+#include "sdt.h" // Vendored SDT header, no systemtap dependency
+
+/*
+ * Static tracepoints on the encode/decode hot paths (provider "stego").
+ * A probe that is not attached is a nop, so they stay in release builds.
+ * Build with -DSTEGO_NO_PROBES to drop them altogether.
+ *
+ *   job__start    (operation)                      e.g. "encode"
+ *   job__end      (operation, status)
+ *   stage__entry  (stage)                          e.g. "check_capacity"
+ *   stage__exit   (stage, status)
+ *   block         (stage, data bytes, image bytes) once per processed block
+ *
+ * String arguments are pointers: in bpftrace use str(arg0).
+ *   bpftrace -e 'usdt:./a.out:stego:stage__entry { @t[str(arg0)] = nsecs; }
+ *                usdt:./a.out:stego:stage__exit  { @ns[str(arg0)] = hist(nsecs - @t[str(arg0)]); }'
+ */
+
+#ifndef STEGO_NO_PROBES
+#define STEGO_PROBE_JOB_START(op)                  STAP_PROBE1(stego, job__start, op)
+#define STEGO_PROBE_JOB_END(op, status)            STAP_PROBE2(stego, job__end, op, status)
+#define STEGO_PROBE_STAGE_ENTRY(stage)             STAP_PROBE1(stego, stage__entry, stage)
+#define STEGO_PROBE_STAGE_EXIT(stage, status)      STAP_PROBE2(stego, stage__exit, stage, status)
+#define STEGO_PROBE_BLOCK(stage, data, image)      STAP_PROBE3(stego, block, stage, data, image)
+#else
+#define STEGO_PROBE_JOB_START(op)                  do { } while (0)
+#define STEGO_PROBE_JOB_END(op, status)            do { } while (0)
+#define STEGO_PROBE_STAGE_ENTRY(stage)             do { } while (0)
+#define STEGO_PROBE_STAGE_EXIT(stage, status)      do { } while (0)
+#define STEGO_PROBE_BLOCK(stage, data, image)      do { } while (0)
+#endif
+
+/* Run one stage between its entry and exit probes, evaluates to the stage status */
+#define STEGO_TRACE_STAGE(stage, call)                  \
+    ({                                                  \
+        __typeof__(call) _stage_status;                 \
+        STEGO_PROBE_STAGE_ENTRY(stage);                 \
+        _stage_status = (call);                         \
+        STEGO_PROBE_STAGE_EXIT(stage, _stage_status);   \
+        _stage_status;                                  \
+    })
+
+#endif
@@ -0,0 +1,76 @@
+/* Minimal SystemTap SDT (USDT) probe header, vendored so no systemtap
+   dev package is needed. Emits the same .note.stapsdt ELF notes as
+   <sys/sdt.h>, which perf, bpftrace, bcc and systemtap all read.
+
+   This file is dedicated to the public domain, as is the original
+   <sys/sdt.h> from systemtap it follows.
+
+   Probes without semaphores: a disabled probe is a single nop and
+   the arguments stay in registers/memory where the compiler has them.
+   Only ELF targets on x86_64 and aarch64 are supported, elsewhere the
+   macros expand to nothing. */
+
+#ifndef SDT_H
+#define SDT_H
+
+#if defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__)) && !defined(SDT_DISABLE)
+
+#define _SDT_STR(x) #x
+#define _SDT_XSTR(x) _SDT_STR(x)
+
+/* Every argument is passed as a signed 64 bit value */
+#define _SDT_ARG(n) "-8@%" #n
+
+#define _SDT_PROBE(provider, name, argfmt, ...)                                 \
+    __asm__ __volatile__ (                                                      \
+        "990: nop\n"                                                           \
+        ".pushsection .note.stapsdt,\"?\",\"note\"\n"                           \
+        ".balign 4\n"                                                           \
+        ".4byte 992f-991f, 994f-993f, 3\n"                                      \
+        "991: .asciz \"stapsdt\"\n"                                             \
+        "992: .balign 4\n"                                                      \
+        "993: .8byte 990b\n"                                                    \
+        ".8byte _.stapsdt.base\n"                                               \
+        ".8byte 0\n"                                                            \
+        ".asciz \"" _SDT_XSTR(provider) "\"\n"                                  \
+        ".asciz \"" _SDT_XSTR(name) "\"\n"                                      \
+        ".asciz \"" argfmt "\"\n"                                               \
+        "994: .balign 4\n"                                                      \
+        ".popsection\n"                                                         \
+        ".ifndef _.stapsdt.base\n"                                              \
+        ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+        ".weak _.stapsdt.base\n"                                                \
+        ".hidden _.stapsdt.base\n"                                              \
+        "_.stapsdt.base: .space 1\n"                                            \
+        ".size _.stapsdt.base, 1\n"                                             \
+        ".popsection\n"                                                         \
+        ".endif\n"                                                              \
+        :: __VA_ARGS__)
+
+#define _SDT_OP(x) "nor" ((long long)(x))
+
+#define STAP_PROBE(provider, name) \
+    _SDT_PROBE(provider, name, "", )
+#define STAP_PROBE1(provider, name, a1) \
+    _SDT_PROBE(provider, name, _SDT_ARG(0), _SDT_OP(a1))
+#define STAP_PROBE2(provider, name, a1, a2) \
+    _SDT_PROBE(provider, name, _SDT_ARG(0) " " _SDT_ARG(1), _SDT_OP(a1), _SDT_OP(a2))
+#define STAP_PROBE3(provider, name, a1, a2, a3) \
+    _SDT_PROBE(provider, name, _SDT_ARG(0) " " _SDT_ARG(1) " " _SDT_ARG(2), _SDT_OP(a1), _SDT_OP(a2), _SDT_OP(a3))
+
+#else
+
+#define STAP_PROBE(provider, name) do { } while (0)
+#define STAP_PROBE1(provider, name, a1) do { (void)(a1); } while (0)
+#define STAP_PROBE2(provider, name, a1, a2) do { (void)(a1); (void)(a2); } while (0)
+#define STAP_PROBE3(provider, name, a1, a2, a3) do { (void)(a1); (void)(a2); (void)(a3); } while (0)
+
+#endif
+
+/* DTrace compatible names */
+#define DTRACE_PROBE(provider, name) STAP_PROBE(provider, name)
+#define DTRACE_PROBE1(provider, name, a1) STAP_PROBE1(provider, name, a1)
+#define DTRACE_PROBE2(provider, name, a1, a2) STAP_PROBE2(provider, name, a1, a2)
+#define DTRACE_PROBE3(provider, name, a1, a2, a3) STAP_PROBE3(provider, name, a1, a2, a3)
+
+#endif
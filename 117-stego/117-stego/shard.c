@@ -0,0 +1,492 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : SHARDED ENCODING/DECODING (shard.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "shard.h"
+#include "encode.h"
+#include "decode.h"
+#include "carrier.h"
+#include "types.h"
+
+// Function definition for read and validate sharded encode args
+Status read_and_validate_shard_encode_args(int argc, char *argv[], ShardInfo *shInfo)
+{
+    char *extn;
+
+    memset(shInfo, 0, sizeof(ShardInfo));
+
+    // -se <secret> <stego prefix> <carrier.bmp>...
+    if (argc < 5)
+    {
+        printf("Error: Usage ./a.out -se secret.txt stego_prefix carrier1.bmp [carrier2.bmp ...]\n");
+        return e_failure;
+    }
+
+    // Secret file must have an extension that fits into the header
+    extn = strrchr(argv[2], '.');
+    if (extn == NULL || strlen(extn) > MAX_FILE_SUFFIX)
+    {
+        printf("Error: Secret file extension is missing or too long\n");
+        return e_failure;
+    }
+    shInfo->secret_fname = argv[2];
+    shInfo->stego_prefix = argv[3];
+
+    if (argc - 4 > MAX_SHARDS)
+    {
+        printf("Error: At most %d carriers are supported\n", MAX_SHARDS);
+        return e_failure;
+    }
+
+    // Every carrier has to be a .bmp file
+    for (int i = 4; i < argc; i++)
+    {
+        extn = strrchr(argv[i], '.');
+        if (extn == NULL || strcmp(extn, ".bmp") != 0)
+        {
+            printf("Error: Carrier %s is not a .bmp file\n", argv[i]);
+            return e_failure;
+        }
+    }
+    shInfo->image_fnames = &argv[4];
+    shInfo->image_count = argc - 4;
+    return e_success;
+}
+
+// Function definition for read and validate sharded decode args
+Status read_and_validate_shard_decode_args(int argc, char *argv[], ShardInfo *shInfo)
+{
+    char *extn;
+
+    memset(shInfo, 0, sizeof(ShardInfo));
+
+    // -sd <output> <stego.bmp>...
+    if (argc < 4)
+    {
+        printf("Error: Usage ./a.out -sd decode.txt stego_0.bmp [stego_1.bmp ...]\n");
+        return e_failure;
+    }
+    shInfo->secret_fname = argv[2];
+
+    if (argc - 3 > MAX_SHARDS)
+    {
+        printf("Error: At most %d stego images are supported\n", MAX_SHARDS);
+        return e_failure;
+    }
+
+    for (int i = 3; i < argc; i++)
+    {
+        extn = strrchr(argv[i], '.');
+        if (extn == NULL || strcmp(extn, ".bmp") != 0)
+        {
+            printf("Error: Stego image %s is not a .bmp file\n", argv[i]);
+            return e_failure;
+        }
+    }
+    shInfo->image_fnames = &argv[3];
+    shInfo->image_count = argc - 3;
+    return e_success;
+}
+
+/*
+ * Carrier bytes used by the shard header:
+ * magic (8 bits per char), extn size (32), extn (8 bits per char),
+ * index fields (32 each) and the shard size (32)
+ */
+uint shard_header_bytes(int extn_size)
+{
+    return strlen(SHARD_MAGIC_STRING) * 8 + 32 + extn_size * 8 + SHARD_INDEX_FIELDS * 32 + 32;
+}
+
+// Function definition for splitting the payload over the carriers
+Status plan_shards(ShardInfo *shInfo)
+{
+    char *extn = strrchr(shInfo->secret_fname, '.');
+    uint header = shard_header_bytes(strlen(extn));
+    uint offset = 0;
+    uint set_id = (uint)time(NULL) ^ ((uint)getpid() << 16);
+    int i;
+
+    shInfo->job_count = 0;
+    for (i = 0; i < shInfo->image_count && (offset < shInfo->size_payload || shInfo->job_count == 0); i++)
+    {
+        ShardJob *job = &shInfo->jobs[shInfo->job_count];
+        FILE *fptr = fopen(shInfo->image_fnames[i], "r");
+        uint image_capacity;
+
+        if (fptr == NULL)
+        {
+            perror("fopen");
+            fprintf(stderr, "ERROR: Unable to open file %s\n", shInfo->image_fnames[i]);
+            return e_failure;
+        }
+        image_capacity = get_image_size_for_bmp(fptr);
+        fclose(fptr);
+
+        // Each payload byte needs 8 carrier bytes after the header
+        job->capacity = image_capacity > header ? (image_capacity - header) / 8 : 0;
+        if (job->capacity == 0)
+        {
+            printf("Carrier %s is too small, skipping\n", shInfo->image_fnames[i]);
+            continue;
+        }
+
+        job->image_fname = shInfo->image_fnames[i];
+        strcpy(job->extn_secret_file, extn);
+        job->data = shInfo->payload + offset;
+        job->size = shInfo->size_payload - offset;
+        if (job->size > job->capacity)
+            job->size = job->capacity;
+        job->index.set_id = set_id;
+        job->index.shard_no = shInfo->job_count;
+        job->index.offset = offset;
+
+        offset += job->size;
+        shInfo->job_count++;
+    }
+
+    if (offset < shInfo->size_payload)
+    {
+        printf("Error: Carriers can hold only %u of %u bytes\n", offset, shInfo->size_payload);
+        return e_failure;
+    }
+
+    // Shard count is known only once every shard has been sized
+    for (i = 0; i < shInfo->job_count; i++)
+        shInfo->jobs[i].index.shard_count = shInfo->job_count;
+
+    return e_success;
+}
+
+// Function definition for the shard encode worker
+void *shard_encode_worker(void *arg)
+{
+    ShardJob *job = arg;
+    EncodeInfo encInfo;     // Per thread buffers and file pointers
+
+    job->status = e_failure;
+    // Shard carriers are always BMP, nothing else of the struct is set up here
+    memset(&encInfo, 0, sizeof(EncodeInfo));
+    encInfo.carrier = &bmp_format;
+
+    encInfo.fptr_src_image = fopen(job->image_fname, "r");
+    if (encInfo.fptr_src_image == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", job->image_fname);
+        return NULL;
+    }
+    encInfo.fptr_stego_image = fopen(job->stego_image_fname, "w");
+    if (encInfo.fptr_stego_image == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", job->stego_image_fname);
+        fclose(encInfo.fptr_src_image);
+        return NULL;
+    }
+
+    // Same layout as do_encoding with the shard index ahead of the size
+    copy_bmp_header(encInfo.fptr_src_image, encInfo.fptr_stego_image);
+    encode_data_to_image(SHARD_MAGIC_STRING, strlen(SHARD_MAGIC_STRING), encInfo.fptr_src_image, encInfo.fptr_stego_image, &encInfo);
+    encode_secret_file_extn_size(strlen(job->extn_secret_file), &encInfo);
+    encode_secret_file_extn(job->extn_secret_file, &encInfo);
+    encode_secret_file_size(job->index.set_id, &encInfo);
+    encode_secret_file_size(job->index.shard_no, &encInfo);
+    encode_secret_file_size(job->index.shard_count, &encInfo);
+    encode_secret_file_size(job->index.offset, &encInfo);
+    encode_secret_file_size(job->size, &encInfo);
+    encode_data_to_image(job->data, job->size, encInfo.fptr_src_image, encInfo.fptr_stego_image, &encInfo);
+    copy_remaining_img_data(encInfo.fptr_src_image, encInfo.fptr_stego_image);
+
+    fclose(encInfo.fptr_src_image);
+    if (fclose(encInfo.fptr_stego_image) == 0)
+        job->status = e_success;
+    return NULL;
+}
+
+// Function definition for do shard encoding
+Status do_shard_encoding(ShardInfo *shInfo)
+{
+    FILE *fptr_secret;
+    Status status = e_success;
+    int i;
+
+    /* Read the whole secret file, shards point into this buffer */
+    fptr_secret = fopen(shInfo->secret_fname, "r");
+    if (fptr_secret == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", shInfo->secret_fname);
+        return e_failure;
+    }
+    shInfo->size_payload = get_file_size(fptr_secret);
+    shInfo->payload = malloc(shInfo->size_payload + 1);
+    if (shInfo->payload == NULL)
+    {
+        printf("Error: Unable to allocate %u bytes for the secret file\n", shInfo->size_payload);
+        fclose(fptr_secret);
+        return e_failure;
+    }
+    fseek(fptr_secret, 0, SEEK_SET);
+    if (fread(shInfo->payload, 1, shInfo->size_payload, fptr_secret) != shInfo->size_payload)
+    {
+        printf("Error: Unable to read secret file %s\n", shInfo->secret_fname);
+        fclose(fptr_secret);
+        return e_failure;
+    }
+    fclose(fptr_secret);
+    printf("Secret file size: %u bytes\n", shInfo->size_payload);
+
+    /* Size each shard to its carrier's capacity */
+    if (plan_shards(shInfo) == e_failure)
+    {
+        printf("Failed to plan shards\n");
+        return e_failure;
+    }
+    printf("Payload split into %d shard(s)\n", shInfo->job_count);
+
+    /* Start one worker per shard */
+    for (i = 0; i < shInfo->job_count; i++)
+    {
+        ShardJob *job = &shInfo->jobs[i];
+
+        // <prefix>_<shard no>.bmp
+        job->stego_image_fname = malloc(strlen(shInfo->stego_prefix) + 16);
+        if (job->stego_image_fname == NULL)
+        {
+            printf("Error: Unable to allocate the name of shard %d\n", i);
+            job->status = e_failure;
+            job->thread = 0;
+            continue;
+        }
+        sprintf(job->stego_image_fname, "%s_%d.bmp", shInfo->stego_prefix, i);
+        if (pthread_create(&job->thread, NULL, shard_encode_worker, job) != 0)
+        {
+            printf("Error: Unable to start worker for shard %d\n", i);
+            job->status = e_failure;
+            job->thread = 0;
+        }
+    }
+
+    /* Wait for all the workers */
+    for (i = 0; i < shInfo->job_count; i++)
+    {
+        ShardJob *job = &shInfo->jobs[i];
+
+        if (job->thread)
+            pthread_join(job->thread, NULL);
+        if (job->status == e_success)
+        {
+            printf("Shard %d: %u bytes at offset %u -> %s\n", i, job->size, job->index.offset, job->stego_image_fname);
+        }
+        else
+        {
+            printf("Failed to encode shard %d into %s\n", i, job->image_fname);
+            status = e_failure;
+        }
+    }
+    return status;
+}
+
+/* Read a 32 bit value from the LSBs of the next 32 image bytes */
+static Status shard_read_uint(FILE *fptr, uint *value)
+{
+    char buffer[32];
+    int size;
+
+    if (fread(buffer, 32, 1, fptr) != 1)
+        return e_failure;
+    decode_size_from_lsb(buffer, &size);
+    *value = (uint)size;
+    return e_success;
+}
+
+/* Read size bytes from the LSBs of the next size * 8 image bytes */
+static Status shard_read_bytes(FILE *fptr, char *data, uint size)
+{
+    char str[8];
+
+    for (uint i = 0; i < size; i++)
+    {
+        if (fread(str, 8, 1, fptr) != 1)
+            return e_failure;
+        decode_byte_from_lsb(&data[i], str);
+    }
+    return e_success;
+}
+
+// Function definition for the shard decode worker
+void *shard_decode_worker(void *arg)
+{
+    ShardJob *job = arg;
+    char magic[sizeof(SHARD_MAGIC_STRING)];
+    uint extn_size, image_capacity, header;
+    FILE *fptr;
+
+    job->status = e_failure;
+
+    fptr = fopen(job->image_fname, "r");
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", job->image_fname);
+        return NULL;
+    }
+
+    // Skip the BMP header (54 bytes) and check the shard magic string
+    image_capacity = get_image_size_for_bmp(fptr);
+    fseek(fptr, 54, SEEK_SET);
+    if (shard_read_bytes(fptr, magic, strlen(SHARD_MAGIC_STRING)) == e_failure)
+        goto out;
+    magic[strlen(SHARD_MAGIC_STRING)] = '\0';
+    if (strcmp(magic, SHARD_MAGIC_STRING) != 0)
+    {
+        printf("Error: %s is not a shard stego image\n", job->image_fname);
+        goto out;
+    }
+
+    // Extension size and extension
+    if (shard_read_uint(fptr, &extn_size) == e_failure || extn_size > MAX_FILE_SUFFIX)
+        goto out;
+    if (shard_read_bytes(fptr, job->extn_secret_file, extn_size) == e_failure)
+        goto out;
+    job->extn_secret_file[extn_size] = '\0';
+
+    // Shard index and shard size
+    if (shard_read_uint(fptr, &job->index.set_id) == e_failure ||
+        shard_read_uint(fptr, &job->index.shard_no) == e_failure ||
+        shard_read_uint(fptr, &job->index.shard_count) == e_failure ||
+        shard_read_uint(fptr, &job->index.offset) == e_failure ||
+        shard_read_uint(fptr, &job->size) == e_failure)
+        goto out;
+
+    // The size comes from the image, it must fit in the slots after the header
+    header = shard_header_bytes(extn_size);
+    if (image_capacity < header || job->size > (image_capacity - header) / 8)
+    {
+        printf("Error: Invalid shard size %u in %s\n", job->size, job->image_fname);
+        goto out;
+    }
+
+    // Shard data
+    job->data = malloc((size_t)job->size + 1);
+    if (job->data == NULL)
+        goto out;
+    if (shard_read_bytes(fptr, job->data, job->size) == e_failure)
+        goto out;
+
+    job->status = e_success;
+out:
+    fclose(fptr);
+    return NULL;
+}
+
+// Function definition for do shard decoding
+Status do_shard_decoding(ShardInfo *shInfo)
+{
+    ShardJob *ordered[MAX_SHARDS] = { NULL };
+    FILE *fptr_secret;
+    uint offset = 0;
+    int i;
+
+    /* Start one worker per stego image */
+    shInfo->job_count = shInfo->image_count;
+    for (i = 0; i < shInfo->job_count; i++)
+    {
+        ShardJob *job = &shInfo->jobs[i];
+
+        job->image_fname = shInfo->image_fnames[i];
+        if (pthread_create(&job->thread, NULL, shard_decode_worker, job) != 0)
+        {
+            printf("Error: Unable to start worker for %s\n", job->image_fname);
+            job->status = e_failure;
+            job->thread = 0;
+        }
+    }
+
+    /* Wait for all the workers before validating the set */
+    for (i = 0; i < shInfo->job_count; i++)
+    {
+        if (shInfo->jobs[i].thread)
+            pthread_join(shInfo->jobs[i].thread, NULL);
+    }
+
+    /* Every shard must belong to the same set and appear exactly once */
+    for (i = 0; i < shInfo->job_count; i++)
+    {
+        ShardJob *job = &shInfo->jobs[i];
+
+        if (job->status == e_failure)
+        {
+            printf("Error: Failed to extract shard from %s\n", job->image_fname);
+            return e_failure;
+        }
+        if (job->index.set_id != shInfo->jobs[0].index.set_id)
+        {
+            printf("Error: %s belongs to a different shard set\n", job->image_fname);
+            return e_failure;
+        }
+        if (job->index.shard_count != (uint)shInfo->job_count)
+        {
+            printf("Error: Set has %u shard(s) but %d image(s) were given\n", job->index.shard_count, shInfo->job_count);
+            return e_failure;
+        }
+        if (job->index.shard_no >= job->index.shard_count || ordered[job->index.shard_no] != NULL)
+        {
+            printf("Error: Duplicate or invalid shard number in %s\n", job->image_fname);
+            return e_failure;
+        }
+        ordered[job->index.shard_no] = job;
+    }
+
+    /* Shards have to be contiguous */
+    for (i = 0; i < shInfo->job_count; i++)
+    {
+        if (ordered[i]->index.offset != offset)
+        {
+            printf("Error: Shard %d starts at offset %u, expected %u\n", i, ordered[i]->index.offset, offset);
+            return e_failure;
+        }
+        offset += ordered[i]->size;
+    }
+
+    /* Reassemble the secret file */
+    fptr_secret = fopen(shInfo->secret_fname, "w");
+    if (fptr_secret == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", shInfo->secret_fname);
+        return e_failure;
+    }
+    for (i = 0; i < shInfo->job_count; i++)
+        fwrite(ordered[i]->data, 1, ordered[i]->size, fptr_secret);
+    if (fclose(fptr_secret) != 0)
+    {
+        printf("Error: Unable to write %s\n", shInfo->secret_fname);
+        return e_failure;
+    }
+
+    shInfo->size_payload = offset;
+    printf("Reassembled %u bytes from %d shard(s) into %s\n", offset, shInfo->job_count, shInfo->secret_fname);
+    return e_success;
+}
+
+// Function definition for releasing the shard buffers
+void free_shard_info(ShardInfo *shInfo)
+{
+    for (int i = 0; i < shInfo->job_count; i++)
+    {
+        free(shInfo->jobs[i].stego_image_fname);
+        // Decoded shards own their data, encoded shards point into the payload
+        if (shInfo->payload == NULL)
+            free(shInfo->jobs[i].data);
+    }
+    free(shInfo->payload);
+    shInfo->payload = NULL;
+    shInfo->job_count = 0;
+}
@@ -0,0 +1,89 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : SHARDED ENCODING/DECODING (shard.h) */
+
+#ifndef SHARD_H
+#define SHARD_H
+
+#include <stdio.h>
+#include <pthread.h>
+#include "types.h" // Contains user defined types
+#include "encode.h"
+
+/*
+ * A payload that does not fit into one carrier is split into
+ * shards, one per carrier, sized to each carrier's capacity.
+ * Every stego image carries a shard index in its header:
+ *
+ *   magic | extn size | extn | set id | shard no | shard count | offset | size | data
+ *
+ * All sizes and index fields are 32 bit values stored in the LSBs
+ * (same as encode_secret_file_size).
+ */
+
+#define SHARD_MAGIC_STRING "#&"     // Magic string to identify a shard stego image
+#define MAX_SHARDS 64               // Maximum number of carriers in one set
+#define SHARD_INDEX_FIELDS 4        // set id, shard no, shard count, offset
+
+typedef struct _ShardIndex {
+    uint set_id;        // Same for every shard of one payload
+    uint shard_no;      // Position of this shard in the set (0 based)
+    uint shard_count;   // Total number of shards in the set
+    uint offset;        // Offset of this shard's data in the payload
+} ShardIndex;
+
+typedef struct _ShardJob {
+    char *image_fname;                      // Carrier (encode) or stego image (decode)
+    char *stego_image_fname;                // Output stego image (encode only)
+    char extn_secret_file[MAX_FILE_SUFFIX + 1]; // Extension of the secret file
+    char *data;                             // Shard data (points into the payload on encode)
+    uint size;                              // Size of the shard data in bytes
+    uint capacity;                          // Payload bytes the carrier can hold
+    ShardIndex index;                       // Shard index stored in the header
+    Status status;                          // Result of the worker
+    pthread_t thread;                       // Worker thread
+} ShardJob;
+
+typedef struct _ShardInfo {
+    char *secret_fname;         // Secret file (encode input / decode output)
+    char *stego_prefix;         // Prefix for the stego images (encode only)
+    char **image_fnames;        // Carriers (encode) or stego images (decode)
+    int image_count;            // Number of entries in image_fnames
+
+    char *payload;              // Whole secret file data
+    uint size_payload;          // Size of the secret file in bytes
+
+    ShardJob jobs[MAX_SHARDS];  // One job per carrier used
+    int job_count;              // Number of jobs (= shard count)
+} ShardInfo;
+
+/* Sharding function prototypes */
+
+/* Read and validate sharded encode args: -se <secret> <stego prefix> <carrier.bmp>... */
+Status read_and_validate_shard_encode_args(int argc, char *argv[], ShardInfo *shInfo);
+
+/* Read and validate sharded decode args: -sd <output> <stego.bmp>... */
+Status read_and_validate_shard_decode_args(int argc, char *argv[], ShardInfo *shInfo);
+
+/* Split the secret across the carriers and encode all shards concurrently */
+Status do_shard_encoding(ShardInfo *shInfo);
+
+/* Extract all shards concurrently and reassemble the secret file */
+Status do_shard_decoding(ShardInfo *shInfo);
+
+/* Number of carrier bytes taken by the shard header for an extension length */
+uint shard_header_bytes(int extn_size);
+
+/* Split the payload over the carriers according to their capacity */
+Status plan_shards(ShardInfo *shInfo);
+
+/* Worker: encode one shard into its carrier */
+void *shard_encode_worker(void *arg);
+
+/* Worker: extract one shard from its stego image */
+void *shard_decode_worker(void *arg);
+
+/* Release the buffers held by the shard info */
+void free_shard_info(ShardInfo *shInfo);
+
+#endif
@@ -0,0 +1,233 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : C++20 INTERFACE (stego.hpp) */
+
+#ifndef STEGO_HPP
+#define STEGO_HPP
+
+/*
+ * Header-only C++20 layer over the encode/decode engine.
+ *  - stego::Encoder / stego::Decoder own their EncodeInfo / DecodeInfo
+ *    and every FILE* (and the decoder's malloc'd strings), are move-only
+ *    and release everything in the destructor.
+ *  - Buffers are std::span<std::byte>. The carrier is read in place
+ *    through fmemopen, the payload is embedded straight from the
+ *    caller's span and decoded straight into it - no staging copies.
+ *  - async_encode / async_decode return awaitables that run the job
+ *    on any executor with post(std::function<void()>) and resume the
+ *    awaiting coroutine on the executor once the job is done.
+ * The engine prints its progress messages with printf as usual.
+ */
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <utility>
+
+extern "C" {
+#include "types.h"
+#include "common.h"
+#include "encode.h"
+#include "decode.h"
+#include "carrier.h"
+}
+
+namespace stego {
+
+/* Open a read-only stream over a caller's buffer, no copy */
+inline FILE *open_span(std::span<const std::byte> buffer)
+{
+    return fmemopen(const_cast<std::byte *>(buffer.data()), buffer.size(), "r");
+}
+
+class Encoder {
+public:
+    Encoder() noexcept { std::memset(&info_, 0, sizeof(info_)); }
+    Encoder(const Encoder &) = delete;
+    Encoder &operator=(const Encoder &) = delete;
+    Encoder(Encoder &&other) noexcept : info_(other.info_) { std::memset(&other.info_, 0, sizeof(other.info_)); }
+    Encoder &operator=(Encoder &&other) noexcept
+    {
+        if (this != &other)
+        {
+            close_files(&info_);
+            info_ = other.info_;
+            std::memset(&other.info_, 0, sizeof(other.info_));
+        }
+        return *this;
+    }
+    ~Encoder() { close_files(&info_); }
+
+    /*
+     * Embed secret into carrier, writing the stego image to stego
+     * (at least carrier.size() bytes). secret_fname only supplies the
+     * extension that is stored with the payload (decoding expects .txt).
+     */
+    Status encode(std::span<const std::byte> carrier, std::span<const std::byte> secret, std::span<std::byte> stego,
+                  const char *secret_fname = "secret.txt", const CarrierFormat *format = &bmp_format)
+    {
+        const char *extn = std::strrchr(secret_fname, '.');
+        Status status = e_failure;
+
+        if (extn == nullptr || std::strlen(extn) > MAX_FILE_SUFFIX || stego.size() < carrier.size())
+            return e_failure;
+        close_files(&info_);
+        info_.carrier = format;
+        info_.secret_fname = const_cast<char *>(secret_fname);
+        info_.size_secret_file = secret.size();
+        info_.fptr_src_image = open_span(carrier);
+        info_.fptr_stego_image = fmemopen(stego.data(), stego.size(), "w");
+        if (info_.fptr_src_image == nullptr || info_.fptr_stego_image == nullptr)
+            return e_failure;
+
+        // Same stages as do_encoding, the secret is embedded from the span
+        if (format->parse_header(info_.fptr_src_image, &info_.carrier_header_size, &info_.image_capacity) == e_success &&
+            info_.image_capacity > get_required_capacity(secret_fname, secret.size()) &&
+            copy_carrier_header(info_.fptr_src_image, info_.fptr_stego_image, info_.carrier_header_size) == e_success)
+        {
+            encode_magic_string(const_cast<char *>(MAGIC_STRING), &info_);
+            encode_secret_file_extn_size(std::strlen(extn), &info_);
+            encode_data_to_image(const_cast<char *>(extn), std::strlen(extn), info_.fptr_src_image, info_.fptr_stego_image, &info_);
+            encode_secret_file_size(secret.size(), &info_);
+            encode_data_to_image(reinterpret_cast<char *>(const_cast<std::byte *>(secret.data())), secret.size(),
+                                 info_.fptr_src_image, info_.fptr_stego_image, &info_);
+            status = copy_remaining_img_data(info_.fptr_src_image, info_.fptr_stego_image);
+        }
+        if (close_files(&info_) == e_failure)
+            status = e_failure;
+        return status;
+    }
+
+private:
+    EncodeInfo info_;
+};
+
+class Decoder {
+public:
+    Decoder() noexcept { std::memset(&info_, 0, sizeof(info_)); }
+    Decoder(const Decoder &) = delete;
+    Decoder &operator=(const Decoder &) = delete;
+    Decoder(Decoder &&other) noexcept : info_(other.info_) { std::memset(&other.info_, 0, sizeof(other.info_)); }
+    Decoder &operator=(Decoder &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            info_ = other.info_;
+            std::memset(&other.info_, 0, sizeof(other.info_));
+        }
+        return *this;
+    }
+    ~Decoder() { release(); }
+
+    /* Decode the header of a stego image, size() is valid afterwards */
+    Status open(std::span<const std::byte> stego, const CarrierFormat *format = &bmp_format)
+    {
+        release();
+        info_.d_carrier = format;
+        info_.fptr_d_src_image = open_span(stego);
+        if (info_.fptr_d_src_image == nullptr)
+            return e_failure;
+
+        // Same stages as do_decoding, up to the secret file size
+        if (decode_magic_string(&info_) == d_failure ||
+            decode_file_extn_size(std::strlen(".txt"), &info_) == d_failure ||
+            decode_secret_file_extn(info_.d_extn_secret_file, &info_) == d_failure ||
+            decode_secret_file_size(&info_) == d_failure || info_.size_secret_file < 0)
+        {
+            release();
+            return e_failure;
+        }
+        return e_success;
+    }
+
+    /* Size of the embedded secret in bytes */
+    std::size_t size() const noexcept { return info_.fptr_d_src_image ? info_.size_secret_file : 0; }
+
+    /* Decode the secret into secret (at least size() bytes) */
+    Status decode(std::span<std::byte> secret)
+    {
+        char slots[8], raw[8 * CARRIER_MAX_STRIDE];
+
+        if (info_.fptr_d_src_image == nullptr || secret.size() < size())
+            return e_failure;
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            if (read_carrier_slots(info_.d_carrier, info_.fptr_d_src_image, raw, slots, 8) == e_failure)
+                return e_failure;
+            decode_byte_from_lsb(reinterpret_cast<char *>(&secret[i]), slots);
+        }
+        return e_success;
+    }
+
+private:
+    /* Close the stego image and free what decode_magic_string / decode_secret_file_extn allocated */
+    void release() noexcept
+    {
+        close_files_dec(&info_);
+        std::memset(&info_, 0, sizeof(info_));
+    }
+
+    DecodeInfo info_;
+};
+
+/* Anything jobs can be posted to: a thread pool, an event loop, ... */
+template <class E>
+concept Executor = requires(E &executor, std::function<void()> job) { executor.post(std::move(job)); };
+
+/* Runs jobs immediately on the calling thread */
+struct InlineExecutor {
+    void post(std::function<void()> job) { job(); }
+};
+
+/* Awaitable running fn on the executor, then resuming the awaiting coroutine there */
+template <Executor E, std::invocable Fn>
+class JobAwaiter {
+public:
+    JobAwaiter(E &executor, Fn fn) : executor_(executor), fn_(std::move(fn)) {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        executor_.post([this, handle] {
+            status_ = fn_();
+            handle.resume();
+        });
+    }
+    Status await_resume() const noexcept { return status_; }
+
+private:
+    E &executor_;
+    Fn fn_;
+    Status status_ = e_failure;
+};
+
+/* co_await async_encode(...) - the buffers must outlive the job */
+template <Executor E>
+auto async_encode(E &executor, Encoder &encoder, std::span<const std::byte> carrier, std::span<const std::byte> secret,
+                  std::span<std::byte> stego, const char *secret_fname = "secret.txt")
+{
+    auto job = [&encoder, carrier, secret, stego, secret_fname] { return encoder.encode(carrier, secret, stego, secret_fname); };
+    return JobAwaiter<E, decltype(job)>(executor, std::move(job));
+}
+
+/* co_await async_decode(...) - decodes into secret, whose size must cover the payload */
+template <Executor E>
+auto async_decode(E &executor, Decoder &decoder, std::span<const std::byte> stego, std::span<std::byte> secret)
+{
+    auto job = [&decoder, stego, secret] {
+        if (decoder.open(stego) == e_failure || decoder.size() > secret.size())
+            return e_failure;
+        return decoder.decode(secret.first(decoder.size()));
+    };
+    return JobAwaiter<E, decltype(job)>(executor, std::move(job));
+}
+
+} // namespace stego
+
+#endif
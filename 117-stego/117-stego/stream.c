@@ -0,0 +1,80 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : STDIN/STDOUT STREAMING (stream.c) */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "stream.h"
+#include "types.h"
+
+// Function definition for checking a stream file name
+int is_stream_fname(const char *fname)
+{
+    return fname != NULL && strcmp(fname, STREAM_FNAME) == 0;
+}
+
+/* Real stdout, kept aside once messages are moved to stderr */
+static int stdout_fd = -1;
+
+/*
+ * Move messages to stderr
+ * Description: All progress messages are printed with printf, so
+ * the real stdout is duplicated for the data and stdout itself is
+ * pointed at stderr. Messages can no longer corrupt the o/p.
+ */
+Status redirect_stdout_messages(void)
+{
+    if (stdout_fd != -1)
+        return e_success;
+
+    fflush(stdout);
+    stdout_fd = dup(STDOUT_FILENO);
+    if (stdout_fd == -1)
+    {
+        perror("dup");
+        return e_failure;
+    }
+    if (dup2(STDERR_FILENO, STDOUT_FILENO) == -1)
+    {
+        perror("dup2");
+        close(stdout_fd);
+        stdout_fd = -1;
+        return e_failure;
+    }
+    return e_success;
+}
+
+// Function definition for opening the o/p data stream on stdout
+FILE *open_stdout_stream(void)
+{
+    if (redirect_stdout_messages() == e_failure)
+        return NULL;
+    return fdopen(stdout_fd, "w");
+}
+
+/* Get image size from an already read BMP header
+ * Description: Width is stored in offset 18 and height after that,
+ * each pixel uses 3 bytes (same as get_image_size_for_bmp)
+ */
+uint get_image_size_from_header(const char *header)
+{
+    uint width, height;
+
+    memcpy(&width, header + 18, sizeof(uint));
+    printf("width = %u\n", width);
+    memcpy(&height, header + 22, sizeof(uint));
+    printf("height = %u\n", height);
+
+    return bmp_header_capacity(header);
+}
+
+// Function definition for image size without printing (for bulk use)
+uint bmp_header_capacity(const char *header)
+{
+    uint width, height;
+
+    memcpy(&width, header + 18, sizeof(uint));
+    memcpy(&height, header + 22, sizeof(uint));
+    return width * height * 3;
+}
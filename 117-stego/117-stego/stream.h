@@ -0,0 +1,36 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : STDIN/STDOUT STREAMING (stream.h) */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * A file name of "-" selects stdin (carrier / stego image) or
+ * stdout (stego image / decoded secret). Such streams are read
+ * strictly forward, the BMP header is parsed from the 54 bytes
+ * already read instead of seeking back to offset 18.
+ */
+
+#define STREAM_FNAME "-"        // File name selecting stdin/stdout
+#define BMP_HEADER_SIZE 54      // Size of the BMP header
+
+/* Check whether a file name selects stdin/stdout */
+int is_stream_fname(const char *fname);
+
+/* Move printf messages to stderr so stdout carries only data */
+Status redirect_stdout_messages(void);
+
+/* Get a stream for the o/p data on stdout, moving messages to stderr */
+FILE *open_stdout_stream(void);
+
+/* Get image size from an already read BMP header (same as get_image_size_for_bmp) */
+uint get_image_size_from_header(const char *header);
+
+/* Same as get_image_size_from_header without printing the dimensions */
+uint bmp_header_capacity(const char *header);
+
+#endif
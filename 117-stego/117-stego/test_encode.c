@@ -7,14 +7,34 @@ Description : Steganography
 
 #include <stdio.h>
 #include <string.h>
+#include <stdlib.h>
 #include "encode.h"
 #include "types.h"
 #include "common.h"
 #include "decode.h"
+#include "shard.h"
+#include "cache.h"
+#include "patch.h"
+#include "stream.h"
+#include "probes.h"
+#include "watch.h"
+#include "broadcast.h"
+#include "checkpoint.h"
+#include "planner.h"
+#include "verify.h"
+#include "adaptive.h"
+#include "bench.h"
+#include "append.h"
 
 /* Passing arguments through command line arguments */
 int main(int argc, char *argv[])
 {
+    // When the o/p is "-" (stdout), keep every message off stdout
+    if ((argc > 4 && check_operation_type(argv) == e_encode && is_stream_fname(argv[4])) ||
+        (argc > 3 && check_operation_type(argv) == e_decode && is_stream_fname(argv[3])) ||
+        (argc > 4 && check_operation_type(argv) == e_verify && is_stream_fname(argv[4])))
+        redirect_stdout_messages();
+
     // Function call for check operation type
     if (check_operation_type(argv) == e_encode)
     {
@@ -26,8 +46,15 @@ int main(int argc, char *argv[])
         {
             printf("Read and validate encode arguments is a success\n");
             printf("<---------- Started Encoding ---------->\n");
-            // Function call for encoding
-            if (do_encoding(&encInfo) == e_success)
+            // Function call for encoding, with checkpoints when --checkpoint/--resume follows the stego image
+            STEGO_PROBE_JOB_START("encode");
+            Status status;
+            if (argc > 5 && (strcmp(argv[5], "--checkpoint") == 0 || strcmp(argv[5], "--resume") == 0))
+                status = do_checkpoint_encoding(&encInfo, strcmp(argv[5], "--resume") == 0, argc > 6 ? strtoul(argv[6], NULL, 10) : 0);
+            else
+                status = do_encoding(&encInfo);
+            STEGO_PROBE_JOB_END("encode", status);
+            if (status == e_success)
             {
                 printf("<--------Completed encoding-------->\n");
             }
@@ -54,7 +81,12 @@ int main(int argc, char *argv[])
             printf("Read and validate decode arguments is a success\n");
             printf("<---------- Started Decoding ---------->\n");
             // Function call for do decoding
-            if (do_decoding(&decInfo) == d_success)
+            STEGO_PROBE_JOB_START("decode");
+            Status_d status = do_decoding(&decInfo);
+            if (close_files_dec(&decInfo) == d_failure)
+                status = d_failure;
+            STEGO_PROBE_JOB_END("decode", status);
+            if (status == d_success)
             {
                 printf("<---------Completed decoding--------->\n");
             }
@@ -70,9 +102,350 @@ int main(int argc, char *argv[])
             return e_failure;
         }
     }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_batch_encode)
+    {
+        printf("Selected batch encoding\n");
+        if (argv[2] == NULL)
+        {
+            printf("Error: Job file is not provided\n");
+            return e_failure;
+        }
+        // Optional carrier cache budget in MB
+        size_t cache_mb = argv[3] != NULL ? strtoul(argv[3], NULL, 10) : DEFAULT_CARRIER_CACHE_MB;
+        printf("<---------- Started Batch Encoding ---------->\n");
+        // Function call for batch encoding
+        if (do_batch_encoding(argv[2], cache_mb << 20) == e_success)
+        {
+            printf("<--------Completed batch encoding-------->\n");
+        }
+        else
+        {
+            printf("Failed to encode one or more jobs\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_patch_encode)
+    {
+        printf("Selected patch encoding\n");
+        // Declare structure variable
+        PatchInfo patInfo;
+        if (read_and_validate_patch_encode_args(argv, &patInfo) == e_success)
+        {
+            printf("<---------- Started Patch Encoding ---------->\n");
+            // Function call for patch encoding
+            if (do_patch_encoding(&patInfo) == e_success)
+            {
+                printf("<--------Completed patch encoding-------->\n");
+            }
+            else
+            {
+                printf("Failed to write patch\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate patch encode arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_patch_apply)
+    {
+        printf("Selected patch apply\n");
+        // Declare structure variable
+        PatchInfo patInfo;
+        if (read_and_validate_patch_apply_args(argv, &patInfo) == e_success)
+        {
+            printf("<---------- Started Patch Apply ---------->\n");
+            // Function call for patch apply
+            if (do_patch_apply(&patInfo) == e_success)
+            {
+                printf("<--------Completed patch apply-------->\n");
+            }
+            else
+            {
+                printf("Failed to apply patch\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate patch apply arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_watch_encode)
+    {
+        printf("Selected watch folder encoding\n");
+        // Declare structure variable
+        WatchInfo wInfo;
+        if (read_and_validate_watch_args(argv, &wInfo) == e_success)
+        {
+            printf("<---------- Started Watching ---------->\n");
+            // Function call for watch encoding, returns on SIGINT/SIGTERM
+            if (do_watch_encoding(&wInfo) == e_success)
+            {
+                printf("<--------Stopped watching-------->\n");
+            }
+            else
+            {
+                printf("Failed to watch\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate watch arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_broadcast_encode)
+    {
+        printf("Selected one-to-many encoding\n");
+        // Declare structure variable
+        BroadcastInfo bInfo;
+        if (read_and_validate_broadcast_args(argc, argv, &bInfo) == e_success)
+        {
+            printf("<---------- Started One-To-Many Encoding ---------->\n");
+            // Function call for one-to-many encoding
+            if (do_broadcast_encoding(&bInfo) == e_success)
+            {
+                printf("<--------Completed one-to-many encoding-------->\n");
+                free_broadcast_info(&bInfo);
+            }
+            else
+            {
+                printf("Failed to encode one or more carriers\n");
+                free_broadcast_info(&bInfo);
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate one-to-many arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_plan)
+    {
+        printf("Selected planning\n");
+        // Declare structure variable
+        PlanInfo pInfo;
+        if (read_and_validate_plan_args(argv, &pInfo) == e_success)
+        {
+            // Function call for planning
+            Status status = do_planning(&pInfo);
+            free_plan_info(&pInfo);
+            if (status == e_success)
+            {
+                printf("<--------Completed planning-------->\n");
+            }
+            else
+            {
+                printf("Failed to plan\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate planner arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_verify)
+    {
+        printf("Selected verification\n");
+        // Declare structure variable
+        VerifyInfo vInfo;
+        if (read_and_validate_verify_args(argv, &vInfo) == e_success)
+        {
+            // Function call for verification
+            if (do_verify(&vInfo) == e_success && vInfo.outside_changed == 0 && vInfo.header_identical)
+            {
+                printf("<--------Completed verification-------->\n");
+            }
+            else
+            {
+                printf("Verification failed\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate verify arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_adaptive_encode)
+    {
+        printf("Selected adaptive encoding\n");
+        // Declare structure variable
+        AdaptiveInfo aInfo;
+        if (read_and_validate_adaptive_encode_args(argv, &aInfo) == e_success)
+        {
+            // Function call for adaptive encoding
+            Status status = do_adaptive_encoding(&aInfo);
+            free_adaptive_info(&aInfo);
+            if (status == e_success)
+            {
+                printf("<--------Completed adaptive encoding-------->\n");
+            }
+            else
+            {
+                printf("Failed to do adaptive encoding\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate adaptive encoding arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_adaptive_decode)
+    {
+        printf("Selected adaptive decoding\n");
+        // Declare structure variable
+        AdaptiveInfo aInfo;
+        if (read_and_validate_adaptive_decode_args(argv, &aInfo) == e_success)
+        {
+            // Function call for adaptive decoding
+            Status status = do_adaptive_decoding(&aInfo);
+            free_adaptive_info(&aInfo);
+            if (status == e_success)
+            {
+                printf("<--------Completed adaptive decoding-------->\n");
+            }
+            else
+            {
+                printf("Failed to do adaptive decoding\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate adaptive decoding arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_bench)
+    {
+        printf("Selected round trip check\n");
+        // Declare structure variable
+        BenchInfo bInfo;
+        if (read_and_validate_bench_args(argv, &bInfo) == e_success)
+        {
+            // Function call for the round trip check
+            if (do_bench(&bInfo) == e_success)
+            {
+                printf("<--------Completed round trip check-------->\n");
+            }
+            else
+            {
+                printf("Round trip check failed\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate round trip check arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_append)
+    {
+        printf("Selected append\n");
+        // Declare structure variable
+        AppendInfo apInfo;
+        if (read_and_validate_append_args(argv, &apInfo) == e_success)
+        {
+            // Function call for the append
+            if (do_append(&apInfo) == e_success)
+            {
+                printf("<--------Completed appending-------->\n");
+            }
+            else
+            {
+                printf("Appending failed\n");
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate append arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_shard_encode)
+    {
+        printf("Selected sharded encoding\n");
+        // Declare structure variable
+        ShardInfo shInfo;
+        if (read_and_validate_shard_encode_args(argc, argv, &shInfo) == e_success)
+        {
+            printf("<---------- Started Sharded Encoding ---------->\n");
+            // Function call for sharded encoding
+            if (do_shard_encoding(&shInfo) == e_success)
+            {
+                printf("<--------Completed sharded encoding-------->\n");
+                free_shard_info(&shInfo);
+            }
+            else
+            {
+                printf("Failed to encode shards\n");
+                free_shard_info(&shInfo);
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate sharded encode arguments is a failure\n");
+            return e_failure;
+        }
+    }
+    // Function call for check operation type
+    else if (check_operation_type(argv) == e_shard_decode)
+    {
+        printf("Selected sharded decoding\n");
+        // Declare structure variable
+        ShardInfo shInfo;
+        if (read_and_validate_shard_decode_args(argc, argv, &shInfo) == e_success)
+        {
+            printf("<---------- Started Sharded Decoding ---------->\n");
+            // Function call for sharded decoding
+            if (do_shard_decoding(&shInfo) == e_success)
+            {
+                printf("<---------Completed sharded decoding--------->\n");
+                free_shard_info(&shInfo);
+            }
+            else
+            {
+                printf("Failed to decode shards\n");
+                free_shard_info(&shInfo);
+                return e_failure;
+            }
+        }
+        else
+        {
+            printf("Read and validate sharded decode arguments is a failure\n");
+            return e_failure;
+        }
+    }
     else
     {
-        printf("Invalid option\nKindly pass for\nEncoding: ./a.out -e beautiful.bmp secret.txt stego.bmp\nDecoding: ./a.out -d stego.bmp decode.txt\n");
+        printf("Invalid option\nKindly pass for\nEncoding: ./a.out -e beautiful.bmp secret.txt stego.bmp [--checkpoint|--resume [interval KB]]\nDecoding: ./a.out -d stego.bmp decode.txt\nStreaming: pass - for the src/stego image or decoded file to use stdin/stdout\nAudio carrier: pass a 16-bit PCM .wav instead of the .bmp for encoding/decoding\nBatch encoding: ./a.out -eb jobs.txt [cache MB]\nPatch encoding: ./a.out -ep beautiful.bmp secret.txt stego.patch\nPatch apply: ./a.out -ap beautiful.bmp stego.patch stego.bmp\nWatch folder: ./a.out -w spool_dir out_dir [workers] [queue size]\nOne-to-many: ./a.out -eo secret.txt stego carrier1.bmp carrier2.bmp ...\nPlanning: ./a.out -p secrets.lst carriers.lst [manifest.txt]\nVerify: ./a.out -v beautiful.bmp stego.bmp [report.json]\nAdaptive encoding: ./a.out -ea beautiful.bmp secret.txt [stego.bmp]\nAdaptive decoding: ./a.out -da stego.bmp [decode.txt]\nRound trip check: ./a.out -bench [baseline.txt] [threshold %%]\nAppend: ./a.out -a stego.bmp delta.txt\nSharded encoding: ./a.out -se secret.txt stego carrier1.bmp carrier2.bmp ...\nSharded decoding: ./a.out -sd decode.txt stego_0.bmp stego_1.bmp ...\n");
     }
     return 0;
 }
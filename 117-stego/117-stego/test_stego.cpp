@@ -0,0 +1,100 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : C++20 INTERFACE ROUND TRIP (test_stego.cpp) */
+
+/*
+ * Round trip through stego.hpp: a plain encode/decode, then the same
+ * with async_encode / async_decode on an InlineExecutor. The carrier
+ * is generated in memory, no files are needed.
+ * Build against the engine objects (every .c except test_encode.c):
+ *   gcc -c $(ls *.c | grep -v test_encode.c)
+ *   g++ -std=c++20 test_stego.cpp *.o -lm -o test_stego
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include "stego.hpp"
+
+/* 24 bpp BMP with a deterministic pixel pattern */
+static std::vector<std::byte> make_carrier(unsigned width, unsigned height)
+{
+    unsigned row_size = (width * 3 + 3) & ~3u;
+    unsigned file_size = 54 + row_size * height;
+    std::vector<std::byte> image(file_size);
+    auto put_le = [&image](unsigned offset, unsigned value, unsigned size) {
+        for (unsigned i = 0; i < size; i++)
+            image[offset + i] = std::byte((value >> (8 * i)) & 0xFF);
+    };
+
+    image[0] = std::byte('B');
+    image[1] = std::byte('M');
+    put_le(2, file_size, 4);
+    put_le(10, 54, 4);
+    put_le(14, 40, 4);
+    put_le(18, width, 4);
+    put_le(22, height, 4);
+    put_le(26, 1, 2);
+    put_le(28, 24, 2);
+    put_le(34, row_size * height, 4);
+    for (unsigned i = 54; i < file_size; i++)
+        image[i] = std::byte((i * 131) >> 3);
+    return image;
+}
+
+/* Coroutine that starts right away, the InlineExecutor finishes it before it returns */
+struct Job {
+    struct promise_type {
+        Job get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::abort(); }
+    };
+};
+
+static Job async_round_trip(std::span<const std::byte> carrier, std::span<const std::byte> secret,
+                            std::span<std::byte> stego_image, std::span<std::byte> decoded, Status &result)
+{
+    stego::InlineExecutor executor;
+    stego::Encoder encoder;
+    stego::Decoder decoder;
+
+    result = co_await stego::async_encode(executor, encoder, carrier, secret, stego_image);
+    if (result == e_success)
+        result = co_await stego::async_decode(executor, decoder, stego_image, decoded);
+}
+
+int main()
+{
+    std::vector<std::byte> carrier = make_carrier(67, 50);
+    std::vector<std::byte> secret(300), stego_image(carrier.size()), decoded(secret.size());
+    int failed = 0;
+
+    for (std::size_t i = 0; i < secret.size(); i++)
+        secret[i] = std::byte(i * 7 + 3);
+
+    /* Encode and decode directly */
+    stego::Encoder encoder;
+    stego::Decoder decoder;
+    if (encoder.encode(carrier, secret, stego_image) != e_success || decoder.open(stego_image) != e_success ||
+        decoder.size() != secret.size() || decoder.decode(decoded) != e_success || decoded != secret)
+    {
+        std::printf("Sync round trip failed\n");
+        failed++;
+    }
+
+    /* Same through the awaitables */
+    Status status = e_failure;
+    std::fill(stego_image.begin(), stego_image.end(), std::byte{0});
+    std::fill(decoded.begin(), decoded.end(), std::byte{0});
+    async_round_trip(carrier, secret, stego_image, decoded, status);
+    if (status != e_success || decoded != secret)
+    {
+        std::printf("Async round trip failed\n");
+        failed++;
+    }
+
+    std::printf("C++ wrapper round trip: %s\n", failed ? "FAILED" : "passed");
+    return failed ? 1 : 0;
+}
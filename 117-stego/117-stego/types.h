@@ -19,6 +19,19 @@ typedef enum
 {
     e_encode,
     e_decode,
+    e_batch_encode,
+    e_patch_encode,
+    e_patch_apply,
+    e_watch_encode,
+    e_broadcast_encode,
+    e_plan,
+    e_verify,
+    e_adaptive_encode,
+    e_adaptive_decode,
+    e_bench,
+    e_append,
+    e_shard_encode,
+    e_shard_decode,
     e_unsupported
 } OperationType;
 
@@ -0,0 +1,366 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : STEGO VS COVER VERIFIER (verify.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "verify.h"
+#include "decode.h"
+#include "stream.h"
+#include "common.h"
+#include "types.h"
+
+// Function definition for read and validate verify args
+Status read_and_validate_verify_args(char *argv[], VerifyInfo *vInfo)
+{
+    memset(vInfo, 0, sizeof(VerifyInfo));
+
+    if (argv[2] == NULL || argv[3] == NULL)
+    {
+        printf("Error: Usage ./a.out -v cover.bmp stego.bmp [report.json]\n");
+        return e_failure;
+    }
+    vInfo->cover_image_fname = argv[2];
+    vInfo->stego_image_fname = argv[3];
+    if (argv[4] != NULL)
+        vInfo->report_fname = argv[4];      // "-" writes the report to stdout
+    else
+        vInfo->report_fname = "verify.json";
+    return e_success;
+}
+
+// Function definition for finding the embedded region
+Status find_embedded_region(VerifyInfo *vInfo)
+{
+    char buffer[32], magic[sizeof(MAGIC_STRING)], extn[8];
+    int magic_size = strlen(MAGIC_STRING), extn_size, size_secret_file;
+    uint i;
+
+    vInfo->region_start = BMP_HEADER_SIZE;
+    vInfo->region_size = 0;
+
+    // Same layout as do_decoding: magic, extn size, extn, size, data
+    fseek(vInfo->fptr_stego_image, BMP_HEADER_SIZE, SEEK_SET);
+    for (i = 0; i < (uint)magic_size; i++)
+    {
+        if (fread(buffer, 8, 1, vInfo->fptr_stego_image) != 1)
+            return e_success;
+        decode_byte_from_lsb(&magic[i], buffer);
+    }
+    magic[magic_size] = '\0';
+    if (strcmp(magic, MAGIC_STRING) != 0)
+    {
+        printf("No magic string in %s, nothing should differ\n", vInfo->stego_image_fname);
+        return e_success;
+    }
+
+    if (fread(buffer, 32, 1, vInfo->fptr_stego_image) != 1)
+        return e_success;
+    decode_size_from_lsb(buffer, &extn_size);
+    if (extn_size < 0 || extn_size > (int)sizeof(extn))
+        return e_success;
+    for (i = 0; i < (uint)extn_size; i++)
+    {
+        if (fread(buffer, 8, 1, vInfo->fptr_stego_image) != 1)
+            return e_success;
+        decode_byte_from_lsb(&extn[i], buffer);
+    }
+    if (fread(buffer, 32, 1, vInfo->fptr_stego_image) != 1)
+        return e_success;
+    decode_size_from_lsb(buffer, &size_secret_file);
+    if (size_secret_file < 0)
+        return e_success;
+
+    vInfo->region_size = magic_size * 8 + 32 + extn_size * 8 + 32 + (unsigned long)size_secret_file * 8;
+    return e_success;
+}
+
+// Function definition for the block comparison kernel
+void verify_block(const unsigned char *cover, const unsigned char *stego, uint size, VerifyStats *stats)
+{
+    uint i = 0;
+
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+
+    while (i + 16 <= size)
+    {
+        __m128i acc_changed = zero, acc_lsb = zero, acc_sq = zero, acc_max = zero;
+        uint64_t lanes[2];
+        uint32_t sq[4];
+        unsigned char max[16];
+        // 32-bit square sums can't overflow within 4096 iterations
+        uint end = i + 16 * 4096 < size ? i + 16 * 4096 : size;
+
+        for (; i + 16 <= end; i += 16)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i *)(cover + i));
+            __m128i b = _mm_loadu_si128((const __m128i *)(stego + i));
+            __m128i diff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+            __m128i lo = _mm_unpacklo_epi8(diff, zero);
+            __m128i hi = _mm_unpackhi_epi8(diff, zero);
+
+            acc_changed = _mm_add_epi64(acc_changed, _mm_sad_epu8(_mm_andnot_si128(_mm_cmpeq_epi8(a, b), one), zero));
+            acc_lsb = _mm_add_epi64(acc_lsb, _mm_sad_epu8(_mm_and_si128(_mm_xor_si128(a, b), one), zero));
+            acc_sq = _mm_add_epi32(acc_sq, _mm_add_epi32(_mm_madd_epi16(lo, lo), _mm_madd_epi16(hi, hi)));
+            acc_max = _mm_max_epu8(acc_max, diff);
+        }
+
+        _mm_storeu_si128((__m128i *)lanes, acc_changed);
+        stats->changed_bytes += lanes[0] + lanes[1];
+        _mm_storeu_si128((__m128i *)lanes, acc_lsb);
+        stats->changed_lsbs += lanes[0] + lanes[1];
+        _mm_storeu_si128((__m128i *)sq, acc_sq);
+        stats->squared_error += (unsigned long long)sq[0] + sq[1] + sq[2] + sq[3];
+        _mm_storeu_si128((__m128i *)max, acc_max);
+        for (int j = 0; j < 16; j++)
+        {
+            if (max[j] > stats->max_deviation)
+                stats->max_deviation = max[j];
+        }
+    }
+#endif
+    for (; i < size; i++)
+    {
+        uint diff = cover[i] > stego[i] ? cover[i] - stego[i] : stego[i] - cover[i];
+
+        stats->changed_bytes += diff != 0;
+        stats->changed_lsbs += (cover[i] ^ stego[i]) & 0x01;
+        stats->squared_error += diff * diff;
+        if (diff > stats->max_deviation)
+            stats->max_deviation = diff;
+    }
+    stats->bytes += size;
+}
+
+/* Add the stats of one range to a total */
+static void verify_stats_add(VerifyStats *total, const VerifyStats *part)
+{
+    total->bytes += part->bytes;
+    total->changed_bytes += part->changed_bytes;
+    total->changed_lsbs += part->changed_lsbs;
+    total->squared_error += part->squared_error;
+    if (part->max_deviation > total->max_deviation)
+        total->max_deviation = part->max_deviation;
+}
+
+/* Write a JSON string with " and \ escaped */
+static void write_json_string(FILE *fptr, const char *str)
+{
+    fputc('"', fptr);
+    for (; *str; str++)
+    {
+        if (*str == '"' || *str == '\\')
+            fputc('\\', fptr);
+        fputc(*str, fptr);
+    }
+    fputc('"', fptr);
+}
+
+// Function definition for writing the JSON report
+Status write_verify_report(VerifyInfo *vInfo)
+{
+    static const char *channel_names[VERIFY_CHANNELS] = { "blue", "green", "red", "alpha" };
+    double mse = vInfo->stats.bytes ? (double)vInfo->stats.squared_error / vInfo->stats.bytes : 0.0;
+    FILE *fptr;
+    int c, v;
+
+    if (is_stream_fname(vInfo->report_fname))
+        fptr = open_stdout_stream();
+    else
+        fptr = fopen(vInfo->report_fname, "w");
+    if (fptr == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open file %s\n", vInfo->report_fname);
+        return e_failure;
+    }
+
+    fprintf(fptr, "{\n  \"cover\": ");
+    write_json_string(fptr, vInfo->cover_image_fname);
+    fprintf(fptr, ",\n  \"stego\": ");
+    write_json_string(fptr, vInfo->stego_image_fname);
+    fprintf(fptr, ",\n  \"width\": %u,\n  \"height\": %u,\n", vInfo->width, vInfo->height);
+    fprintf(fptr, "  \"header_identical\": %s,\n", vInfo->header_identical ? "true" : "false");
+    fprintf(fptr, "  \"embedded_region\": { \"offset\": %lu, \"size\": %lu },\n", vInfo->region_start, vInfo->region_size);
+    fprintf(fptr, "  \"outside_region_identical\": %s,\n", vInfo->outside_changed == 0 && vInfo->header_identical ? "true" : "false");
+    fprintf(fptr, "  \"outside_changed_bytes\": %llu,\n", vInfo->outside_changed);
+    fprintf(fptr, "  \"bytes\": %llu,\n", vInfo->stats.bytes);
+    fprintf(fptr, "  \"changed_bytes\": %llu,\n", vInfo->stats.changed_bytes);
+    fprintf(fptr, "  \"changed_lsbs\": %llu,\n", vInfo->stats.changed_lsbs);
+    fprintf(fptr, "  \"max_deviation\": %u,\n", vInfo->stats.max_deviation);
+    fprintf(fptr, "  \"mse\": %.9g,\n", mse);
+    // Identical images have infinite PSNR, reported as null
+    if (mse > 0.0)
+        fprintf(fptr, "  \"psnr\": %.4f,\n", 10.0 * log10(255.0 * 255.0 / mse));
+    else
+        fprintf(fptr, "  \"psnr\": null,\n");
+
+    fprintf(fptr, "  \"channels\": [\n");
+    for (c = 0; c < (int)vInfo->bytes_per_pixel; c++)
+    {
+        fprintf(fptr, "    { \"name\": \"%s\", \"changed_bytes\": %llu,\n      \"cover_histogram\": [",
+                channel_names[c], vInfo->channel_changed[c]);
+        for (v = 0; v < 256; v++)
+            fprintf(fptr, v ? ",%llu" : "%llu", vInfo->cover_hist[c][v]);
+        fprintf(fptr, "],\n      \"stego_histogram\": [");
+        for (v = 0; v < 256; v++)
+            fprintf(fptr, v ? ",%llu" : "%llu", vInfo->stego_hist[c][v]);
+        fprintf(fptr, "] }%s\n", c < (int)vInfo->bytes_per_pixel - 1 ? "," : "");
+    }
+    fprintf(fptr, "  ]\n}\n");
+
+    if (fclose(fptr) != 0)
+        return e_failure;
+    return e_success;
+}
+
+// Function definition for do verify
+Status do_verify(VerifyInfo *vInfo)
+{
+    unsigned char *cover = NULL, *stego = NULL;
+    char cover_header[BMP_HEADER_SIZE], stego_header[BMP_HEADER_SIZE];
+    VerifyStats outside;
+    unsigned long offset = BMP_HEADER_SIZE, region_end;
+    uint pixel_bytes, block_size, pixel_offset, stego_pixel_offset;
+    unsigned short bits_per_pixel;
+    Status status = e_failure;
+    size_t n;
+
+    vInfo->fptr_cover_image = fopen(vInfo->cover_image_fname, "r");
+    vInfo->fptr_stego_image = fopen(vInfo->stego_image_fname, "r");
+    if (vInfo->fptr_cover_image == NULL || vInfo->fptr_stego_image == NULL)
+    {
+        perror("fopen");
+        fprintf(stderr, "ERROR: Unable to open %s or %s\n", vInfo->cover_image_fname, vInfo->stego_image_fname);
+        goto out;
+    }
+
+    /* Headers, read the same way as copy_bmp_header */
+    if (fread(cover_header, BMP_HEADER_SIZE, 1, vInfo->fptr_cover_image) != 1 ||
+        fread(stego_header, BMP_HEADER_SIZE, 1, vInfo->fptr_stego_image) != 1)
+    {
+        printf("Error: Image is shorter than a BMP header\n");
+        goto out;
+    }
+    /* The encoder embeds right after a 54 byte header, so the pixel data
+       must start there too or the region and histograms would be off */
+    memcpy(&pixel_offset, cover_header + 10, sizeof(uint));
+    memcpy(&stego_pixel_offset, stego_header + 10, sizeof(uint));
+    if (pixel_offset != BMP_HEADER_SIZE || stego_pixel_offset != BMP_HEADER_SIZE)
+    {
+        printf("Error: Pixel data at offset %u/%u, only %d byte BMP headers are supported\n", pixel_offset, stego_pixel_offset, BMP_HEADER_SIZE);
+        goto out;
+    }
+    vInfo->header_identical = memcmp(cover_header, stego_header, BMP_HEADER_SIZE) == 0;
+    memcpy(&vInfo->width, cover_header + 18, sizeof(uint));
+    memcpy(&vInfo->height, cover_header + 22, sizeof(uint));
+    memcpy(&bits_per_pixel, cover_header + 28, sizeof(bits_per_pixel));
+    if (bits_per_pixel != 24 && bits_per_pixel != 32)
+    {
+        printf("Error: %u bits per pixel is not supported\n", bits_per_pixel);
+        goto out;
+    }
+    vInfo->bytes_per_pixel = bits_per_pixel / 8;
+    // Row size must be non zero and fit a uint once padded
+    if (vInfo->width == 0 || vInfo->height == 0 || vInfo->width > (UINT32_MAX - 3) / vInfo->bytes_per_pixel)
+    {
+        printf("Error: Invalid image dimensions %u x %u\n", vInfo->width, vInfo->height);
+        goto out;
+    }
+    pixel_bytes = vInfo->width * vInfo->bytes_per_pixel;
+    vInfo->row_size = (pixel_bytes + 3) & ~3u;     // Rows are padded to 4 bytes
+
+    // Blocks hold whole rows, so every block starts on a pixel
+    block_size = vInfo->row_size >= VERIFY_BLOCK_SIZE ? vInfo->row_size : VERIFY_BLOCK_SIZE / vInfo->row_size * vInfo->row_size;
+    cover = malloc(block_size);
+    stego = malloc(block_size);
+    if (cover == NULL || stego == NULL)
+    {
+        printf("Error: Unable to allocate %u byte blocks\n", block_size);
+        goto out;
+    }
+
+    find_embedded_region(vInfo);
+    region_end = vInfo->region_start + vInfo->region_size;
+    fseek(vInfo->fptr_stego_image, BMP_HEADER_SIZE, SEEK_SET);
+    memset(&outside, 0, sizeof(VerifyStats));
+
+    /* Stream both images block by block */
+    while ((n = fread(cover, 1, block_size, vInfo->fptr_cover_image)) > 0)
+    {
+        VerifyStats inside;
+        unsigned long end = offset + n;
+        // Part of this block inside the embedded region
+        unsigned long in_start = offset > vInfo->region_start ? offset : vInfo->region_start;
+        unsigned long in_end = end < region_end ? end : region_end;
+
+        if (fread(stego, 1, n, vInfo->fptr_stego_image) != n)
+        {
+            printf("Error: Stego image is shorter than the cover image\n");
+            goto out;
+        }
+
+        memset(&inside, 0, sizeof(VerifyStats));
+        if (in_start < in_end)
+        {
+            verify_block(cover, stego, in_start - offset, &outside);
+            verify_block(cover + (in_start - offset), stego + (in_start - offset), in_end - in_start, &inside);
+            verify_block(cover + (in_end - offset), stego + (in_end - offset), end - in_end, &outside);
+        }
+        else
+        {
+            verify_block(cover, stego, n, &outside);
+        }
+        verify_stats_add(&vInfo->stats, &inside);
+
+        /* Per-channel histograms pixel by pixel, row padding is not a channel */
+        for (size_t row = 0; row < n; row += vInfo->row_size)
+        {
+            size_t row_end = row + pixel_bytes < n ? row + pixel_bytes : n;
+
+            for (size_t p = row; p + vInfo->bytes_per_pixel <= row_end; p += vInfo->bytes_per_pixel)
+            {
+                for (uint c = 0; c < vInfo->bytes_per_pixel; c++)
+                {
+                    vInfo->cover_hist[c][cover[p + c]]++;
+                    vInfo->stego_hist[c][stego[p + c]]++;
+                    vInfo->channel_changed[c] += cover[p + c] != stego[p + c];
+                }
+            }
+        }
+        offset = end;
+    }
+    if (fgetc(vInfo->fptr_stego_image) != EOF)
+        outside.changed_bytes++;    // Stego image is longer than the cover
+
+    vInfo->outside_changed = outside.changed_bytes;
+    verify_stats_add(&vInfo->stats, &outside);
+
+    if (write_verify_report(vInfo) == e_failure)
+    {
+        printf("Failed to write report %s\n", vInfo->report_fname);
+        goto out;
+    }
+    printf("%llu changed LSB(s), max deviation %u, %s outside the embedded region -> %s\n",
+           vInfo->stats.changed_lsbs, vInfo->stats.max_deviation,
+           vInfo->outside_changed == 0 && vInfo->header_identical ? "identical" : "DIFFERENT",
+           vInfo->report_fname);
+    status = e_success;
+
+out:
+    if (vInfo->fptr_cover_image)
+        fclose(vInfo->fptr_cover_image);
+    if (vInfo->fptr_stego_image)
+        fclose(vInfo->fptr_stego_image);
+    free(cover);
+    free(stego);
+    return status;
+}
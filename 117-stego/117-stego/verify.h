@@ -0,0 +1,72 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : STEGO VS COVER VERIFIER (verify.h) */
+
+#ifndef VERIFY_H
+#define VERIFY_H
+
+#include <stdio.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * Compare a cover image with its stego image in one streaming pass:
+ * changed bytes / changed LSBs, MSE, PSNR, maximum deviation and
+ * per-channel (B, G, R and A for 32 bpp) value histograms of both
+ * images, read pixel by pixel from the BMP bits per pixel. The embedded
+ * region is taken from the stego header (magic, extn size, extn, size);
+ * every byte outside it, including the BMP header, must be identical.
+ * The report is written as JSON.
+ */
+
+#define VERIFY_BLOCK_SIZE 65536     // Bytes compared per block
+#define VERIFY_CHANNELS 4           // B, G, R, A
+
+typedef struct _VerifyStats {
+    unsigned long long bytes;           // Pixel bytes compared
+    unsigned long long changed_bytes;   // Bytes that differ at all
+    unsigned long long changed_lsbs;    // Bytes whose LSB differs
+    unsigned long long squared_error;   // Sum of (stego - cover)^2
+    uint max_deviation;                 // Largest |stego - cover|
+} VerifyStats;
+
+typedef struct _VerifyInfo {
+    char *cover_image_fname;    // Filename - cover image
+    FILE *fptr_cover_image;
+    char *stego_image_fname;    // Filename - stego image
+    FILE *fptr_stego_image;
+    char *report_fname;         // O/p JSON report ("-" for stdout)
+
+    uint width;                 // From the BMP header
+    uint height;
+    uint bytes_per_pixel;       // 3 (B, G, R) or 4 (B, G, R, A)
+    uint row_size;              // Bytes per row including padding
+    int header_identical;       // BMP headers match
+
+    unsigned long region_start; // First embedded byte (after the BMP header)
+    unsigned long region_size;  // Embedded bytes, 0 when no magic string
+    unsigned long long outside_changed; // Changed bytes outside the region
+
+    VerifyStats stats;
+    unsigned long long channel_changed[VERIFY_CHANNELS];
+    unsigned long long cover_hist[VERIFY_CHANNELS][256];
+    unsigned long long stego_hist[VERIFY_CHANNELS][256];
+} VerifyInfo;
+
+/* Verify function prototypes */
+
+/* Read and validate verify args: -v <cover.bmp> <stego.bmp> [report.json] */
+Status read_and_validate_verify_args(char *argv[], VerifyInfo *vInfo);
+
+/* Compare the images and write the report */
+Status do_verify(VerifyInfo *vInfo);
+
+/* Find the embedded region from the stego header */
+Status find_embedded_region(VerifyInfo *vInfo);
+
+/* Changed bytes/LSBs, squared error and max deviation of one block */
+void verify_block(const unsigned char *cover, const unsigned char *stego, uint size, VerifyStats *stats);
+
+/* Write the JSON report */
+Status write_verify_report(VerifyInfo *vInfo);
+
+#endif
@@ -0,0 +1,407 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : WATCH FOLDER ENCODING (watch.c) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+#include "watch.h"
+#include "encode.h"
+#include "probes.h"
+#include "arena.h"
+#include "types.h"
+
+/* Set by SIGINT/SIGTERM */
+static volatile sig_atomic_t watch_stop = 0;
+
+static void watch_signal_handler(int sig)
+{
+    (void)sig;
+    watch_stop = 1;
+}
+
+// Function definition for read and validate watch args
+Status read_and_validate_watch_args(char *argv[], WatchInfo *wInfo)
+{
+    struct stat spool_st, out_st;
+
+    memset(wInfo, 0, sizeof(WatchInfo));
+
+    if (argv[2] == NULL || argv[3] == NULL)
+    {
+        printf("Error: Usage ./a.out -w spool_dir out_dir [workers] [queue size]\n");
+        return e_failure;
+    }
+    wInfo->spool_dir = argv[2];
+    wInfo->out_dir = argv[3];
+
+    // Stego images written to the spool directory would be picked up as new jobs
+    if (stat(wInfo->spool_dir, &spool_st) == 0 && stat(wInfo->out_dir, &out_st) == 0 &&
+        spool_st.st_dev == out_st.st_dev && spool_st.st_ino == out_st.st_ino)
+    {
+        printf("Error: Output directory must not be the spool directory\n");
+        return e_failure;
+    }
+
+    wInfo->worker_count = argv[4] != NULL ? atoi(argv[4]) : WATCH_DEFAULT_WORKERS;
+    if (wInfo->worker_count < 1 || wInfo->worker_count > WATCH_MAX_WORKERS)
+    {
+        printf("Error: Workers must be between 1 and %d\n", WATCH_MAX_WORKERS);
+        return e_failure;
+    }
+    wInfo->queue_size = (argv[4] != NULL && argv[5] != NULL) ? atoi(argv[5]) : WATCH_DEFAULT_QUEUE;
+    if (wInfo->queue_size < 1)
+    {
+        printf("Error: Queue size must be at least 1\n");
+        return e_failure;
+    }
+    return e_success;
+}
+
+// Function definition for pushing a job
+Status watch_queue_push(WatchInfo *wInfo, const char *name)
+{
+    pthread_mutex_lock(&wInfo->lock);
+
+    // Backpressure - wait for a worker to free a slot
+    if (wInfo->queue_count == wInfo->queue_size)
+        printf("Queue full, waiting for a worker\n");
+    while (wInfo->queue_count == wInfo->queue_size)
+        pthread_cond_wait(&wInfo->not_full, &wInfo->lock);
+
+    WatchJob *job = &wInfo->queue[(wInfo->queue_head + wInfo->queue_count) % wInfo->queue_size];
+    snprintf(job->name, sizeof(job->name), "%s", name);
+    wInfo->queue_count++;
+
+    pthread_cond_signal(&wInfo->not_empty);
+    pthread_mutex_unlock(&wInfo->lock);
+    return e_success;
+}
+
+// Function definition for popping a job
+Status watch_queue_pop(WatchInfo *wInfo, WatchJob *job)
+{
+    pthread_mutex_lock(&wInfo->lock);
+    while (wInfo->queue_count == 0 && !wInfo->closed)
+        pthread_cond_wait(&wInfo->not_empty, &wInfo->lock);
+
+    if (wInfo->queue_count == 0)
+    {
+        pthread_mutex_unlock(&wInfo->lock);
+        return e_failure;
+    }
+
+    *job = wInfo->queue[wInfo->queue_head];
+    wInfo->queue_head = (wInfo->queue_head + 1) % wInfo->queue_size;
+    wInfo->queue_count--;
+
+    pthread_cond_signal(&wInfo->not_full);
+    pthread_mutex_unlock(&wInfo->lock);
+    return e_success;
+}
+
+/* Find a job in the in-flight list, wInfo->lock must be held */
+static WatchPending **watch_find_in_flight(WatchInfo *wInfo, const char *name)
+{
+    WatchPending **link;
+
+    for (link = &wInfo->in_flight; *link; link = &(*link)->next)
+    {
+        if (strcmp((*link)->name, name) == 0)
+            break;
+    }
+    return link;
+}
+
+/* Drop a finished job from the in-flight list */
+static void watch_job_finished(WatchInfo *wInfo, const char *name)
+{
+    WatchPending **link, *entry;
+
+    pthread_mutex_lock(&wInfo->lock);
+    link = watch_find_in_flight(wInfo, name);
+    entry = *link;
+    if (entry != NULL)
+        *link = entry->next;
+    pthread_mutex_unlock(&wInfo->lock);
+    free(entry);
+}
+
+// Function definition for a completed file in the spool directory
+Status watch_file_complete(WatchInfo *wInfo, const char *fname)
+{
+    char name[WATCH_MAX_NAME];
+    const char *extn = strrchr(fname, '.');
+    WatchPending **link, *entry;
+    size_t len;
+
+    // Only <name>.bmp and <name>.txt take part in a job
+    if (extn == NULL || (strcmp(extn, ".bmp") != 0 && strcmp(extn, ".txt") != 0))
+        return e_success;
+    len = extn - fname;
+    if (len == 0 || len >= WATCH_MAX_NAME)
+        return e_success;
+    memcpy(name, fname, len);
+    name[len] = '\0';
+
+    // Already queued or running - a rescan still sees its inputs until they are renamed
+    pthread_mutex_lock(&wInfo->lock);
+    entry = *watch_find_in_flight(wInfo, name);
+    pthread_mutex_unlock(&wInfo->lock);
+    if (entry != NULL)
+        return e_success;
+
+    for (link = &wInfo->pending; *link; link = &(*link)->next)
+    {
+        if (strcmp((*link)->name, name) == 0)
+            break;
+    }
+    entry = *link;
+    if (entry == NULL)
+    {
+        entry = calloc(1, sizeof(WatchPending));
+        if (entry == NULL)
+            return e_failure;
+        strcpy(entry->name, name);
+        *link = entry;
+    }
+
+    if (strcmp(extn, ".bmp") == 0)
+        entry->have_image = 1;
+    else
+        entry->have_secret = 1;
+
+    // Both halves complete - the entry moves to the in-flight list and the job to the workers
+    if (entry->have_image && entry->have_secret)
+    {
+        char src[WATCH_MAX_NAME * 2], secret[WATCH_MAX_NAME * 2];
+
+        *link = entry->next;
+        // Events queued before the job finished, its inputs are already *.done
+        snprintf(src, sizeof(src), "%s/%s.bmp", wInfo->spool_dir, name);
+        snprintf(secret, sizeof(secret), "%s/%s.txt", wInfo->spool_dir, name);
+        if (access(src, F_OK) != 0 || access(secret, F_OK) != 0)
+        {
+            free(entry);
+            return e_success;
+        }
+        pthread_mutex_lock(&wInfo->lock);
+        entry->next = wInfo->in_flight;
+        wInfo->in_flight = entry;
+        pthread_mutex_unlock(&wInfo->lock);
+        watch_queue_push(wInfo, name);
+    }
+    return e_success;
+}
+
+/* Feed every file already in the spool directory */
+static Status watch_scan_dir(WatchInfo *wInfo)
+{
+    struct dirent *dent;
+    DIR *dir = opendir(wInfo->spool_dir);
+
+    if (dir == NULL)
+    {
+        perror("opendir");
+        fprintf(stderr, "ERROR: Unable to open directory %s\n", wInfo->spool_dir);
+        return e_failure;
+    }
+    while ((dent = readdir(dir)) != NULL)
+    {
+        if (dent->d_type == DT_REG || dent->d_type == DT_UNKNOWN)
+            watch_file_complete(wInfo, dent->d_name);
+    }
+    closedir(dir);
+    return e_success;
+}
+
+/* Rename a processed input to <fname>.done so it is not paired again */
+static void watch_mark_done(const char *fname)
+{
+    char done_fname[WATCH_MAX_NAME * 2 + 8];
+
+    snprintf(done_fname, sizeof(done_fname), "%s.done", fname);
+    if (rename(fname, done_fname) != 0)
+        perror("rename");
+}
+
+// Function definition for the watch worker
+void *watch_worker(void *arg)
+{
+    WatchInfo *wInfo = arg;
+    WatchJob job;
+    Arena arena;
+
+    // One arena per worker, no allocator sharing between workers
+    if (init_arena(&arena, ARENA_DEFAULT_SIZE) == e_failure)
+        memset(&arena, 0, sizeof(Arena));
+
+    while (watch_queue_pop(wInfo, &job) == e_success)
+    {
+        char src[WATCH_MAX_NAME * 2], secret[WATCH_MAX_NAME * 2], stego[WATCH_MAX_NAME * 2];
+        char *args[] = { "a.out", "-e", src, secret, stego, NULL };
+        EncodeInfo encInfo;
+        Status status;
+
+        snprintf(src, sizeof(src), "%s/%s.bmp", wInfo->spool_dir, job.name);
+        snprintf(secret, sizeof(secret), "%s/%s.txt", wInfo->spool_dir, job.name);
+        snprintf(stego, sizeof(stego), "%s/%s.bmp", wInfo->out_dir, job.name);
+
+        memset(&encInfo, 0, sizeof(EncodeInfo));
+        STEGO_PROBE_JOB_START("encode");
+        status = read_and_validate_encode_args(args, &encInfo);
+        encInfo.arena = arena.base != NULL ? &arena : NULL;
+        if (status == e_success)
+            status = do_encoding(&encInfo);
+        if (close_files(&encInfo) == e_failure)
+            status = e_failure;
+        if (arena.base != NULL)
+            reset_arena(&arena);
+        STEGO_PROBE_JOB_END("encode", status);
+
+        pthread_mutex_lock(&wInfo->lock);
+        if (status == e_success)
+            wInfo->done++;
+        else
+            wInfo->failed++;
+        pthread_mutex_unlock(&wInfo->lock);
+
+        if (status == e_success)
+        {
+            watch_mark_done(src);
+            watch_mark_done(secret);
+            printf("Job %s: encoded to %s\n", job.name, stego);
+        }
+        else
+        {
+            printf("Job %s: failed to encode\n", job.name);
+        }
+        watch_job_finished(wInfo, job.name);
+    }
+    free_arena(&arena);
+    return NULL;
+}
+
+// Function definition for do watch encoding
+Status do_watch_encoding(WatchInfo *wInfo)
+{
+    struct sigaction sa;
+    sigset_t mask;
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    Status status = e_success;
+    int i, started = 0;
+
+    /* Stop on SIGINT/SIGTERM, without SA_RESTART so read() is interrupted */
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = watch_signal_handler;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    wInfo->queue = calloc(wInfo->queue_size, sizeof(WatchJob));
+    if (wInfo->queue == NULL)
+        return e_failure;
+    pthread_mutex_init(&wInfo->lock, NULL);
+    pthread_cond_init(&wInfo->not_empty, NULL);
+    pthread_cond_init(&wInfo->not_full, NULL);
+
+    /* Watch before scanning so no file falls in between */
+    wInfo->inotify_fd = inotify_init1(IN_CLOEXEC);
+    if (wInfo->inotify_fd == -1 ||
+        inotify_add_watch(wInfo->inotify_fd, wInfo->spool_dir, IN_CLOSE_WRITE | IN_MOVED_TO) == -1)
+    {
+        perror("inotify");
+        fprintf(stderr, "ERROR: Unable to watch directory %s\n", wInfo->spool_dir);
+        status = e_failure;
+        goto out;
+    }
+
+    /* Workers block the stop signals, so they always interrupt the watcher's read() */
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &mask, NULL);
+    for (i = 0; i < wInfo->worker_count; i++)
+    {
+        if (pthread_create(&wInfo->workers[i], NULL, watch_worker, wInfo) != 0)
+            break;
+        started++;
+    }
+    pthread_sigmask(SIG_UNBLOCK, &mask, NULL);
+    if (started < wInfo->worker_count)
+    {
+        printf("Error: Unable to start worker %d\n", started);
+        status = e_failure;
+        goto out;
+    }
+    printf("Watching %s with %d worker(s), queue of %d\n", wInfo->spool_dir, wInfo->worker_count, wInfo->queue_size);
+
+    if (watch_scan_dir(wInfo) == e_failure)
+    {
+        status = e_failure;
+        goto out;
+    }
+
+    while (!watch_stop)
+    {
+        ssize_t len = read(wInfo->inotify_fd, buffer, sizeof(buffer));
+        char *ptr;
+
+        if (len == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("read");
+            status = e_failure;
+            break;
+        }
+
+        for (ptr = buffer; ptr < buffer + len; ptr += sizeof(struct inotify_event) + ((struct inotify_event *)ptr)->len)
+        {
+            struct inotify_event *event = (struct inotify_event *)ptr;
+
+            // Events were dropped by the kernel, pick them up from the directory
+            if (event->mask & IN_Q_OVERFLOW)
+                watch_scan_dir(wInfo);
+            else if (event->len > 0)
+                watch_file_complete(wInfo, event->name);
+        }
+    }
+    printf("Stopping, finishing queued jobs\n");
+
+out:
+    /* Let the workers drain the queue and exit */
+    pthread_mutex_lock(&wInfo->lock);
+    wInfo->closed = 1;
+    pthread_cond_broadcast(&wInfo->not_empty);
+    pthread_mutex_unlock(&wInfo->lock);
+    for (i = 0; i < started; i++)
+        pthread_join(wInfo->workers[i], NULL);
+
+    if (wInfo->inotify_fd != -1)
+        close(wInfo->inotify_fd);
+    while (wInfo->pending)
+    {
+        WatchPending *next = wInfo->pending->next;
+        free(wInfo->pending);
+        wInfo->pending = next;
+    }
+    while (wInfo->in_flight)
+    {
+        WatchPending *next = wInfo->in_flight->next;
+        free(wInfo->in_flight);
+        wInfo->in_flight = next;
+    }
+    free(wInfo->queue);
+    pthread_mutex_destroy(&wInfo->lock);
+    pthread_cond_destroy(&wInfo->not_empty);
+    pthread_cond_destroy(&wInfo->not_full);
+
+    printf("%lu job(s) encoded, %lu failed\n", wInfo->done, wInfo->failed);
+    return status;
+}
@@ -0,0 +1,82 @@
+/* NAME : VISHNU VARDHAN.E
+   DATE : 19-10-2026
+   DESCRIPTION : WATCH FOLDER ENCODING (watch.h) */
+
+#ifndef WATCH_H
+#define WATCH_H
+
+#include <stdio.h>
+#include <pthread.h>
+#include "types.h" // Contains user defined types
+
+/*
+ * Watch a spool directory with inotify and encode carriers as soon
+ * as they are complete (IN_CLOSE_WRITE / IN_MOVED_TO).
+ * Naming rule: <name>.bmp is paired with <name>.txt and encoded to
+ * <out dir>/<name>.bmp. Processed inputs are renamed to *.done.
+ * Jobs go through a bounded queue drained by encode workers; when the
+ * queue is full the watcher blocks until a worker takes a job.
+ */
+
+#define WATCH_MAX_NAME 256          // Maximum length of a job name / path
+#define WATCH_DEFAULT_WORKERS 4     // Encode workers
+#define WATCH_DEFAULT_QUEUE 16      // Queue slots
+#define WATCH_MAX_WORKERS 64        // Upper limit for workers
+
+typedef struct _WatchJob {
+    char name[WATCH_MAX_NAME];      // <name> without extension
+} WatchJob;
+
+/* Name seen with only one half of the pair so far */
+typedef struct _WatchPending {
+    char name[WATCH_MAX_NAME];
+    int have_image;                 // <name>.bmp is complete
+    int have_secret;                // <name>.txt is complete
+    struct _WatchPending *next;
+} WatchPending;
+
+typedef struct _WatchInfo {
+    char *spool_dir;                // Directory to watch
+    char *out_dir;                  // Directory for the stego images
+    int worker_count;               // Number of encode workers
+    int inotify_fd;                 // inotify instance
+
+    /* Bounded work queue */
+    WatchJob *queue;                // Ring buffer of queue_size slots
+    int queue_size;
+    int queue_head;                 // Next job to take
+    int queue_count;                // Jobs in the queue
+    int closed;                     // No more jobs will be pushed
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+
+    WatchPending *pending;          // Names waiting for their pair
+    WatchPending *in_flight;        // Jobs queued or running, inputs not yet renamed to .done
+    pthread_t workers[WATCH_MAX_WORKERS];
+
+    unsigned long done;             // Jobs encoded
+    unsigned long failed;           // Jobs that failed
+} WatchInfo;
+
+/* Watch function prototypes */
+
+/* Read and validate watch args: -w <spool dir> <out dir> [workers] [queue size] */
+Status read_and_validate_watch_args(char *argv[], WatchInfo *wInfo);
+
+/* Watch the spool directory until SIGINT/SIGTERM */
+Status do_watch_encoding(WatchInfo *wInfo);
+
+/* Record a completed file and queue the job once its pair is complete */
+Status watch_file_complete(WatchInfo *wInfo, const char *fname);
+
+/* Push a job, blocking while the queue is full */
+Status watch_queue_push(WatchInfo *wInfo, const char *name);
+
+/* Pop a job, blocking while the queue is empty. e_failure once closed and drained */
+Status watch_queue_pop(WatchInfo *wInfo, WatchJob *job);
+
+/* Worker: encode jobs from the queue */
+void *watch_worker(void *arg);
+
+#endif